@@ -35,6 +35,11 @@ THE SOFTWARE.
 #include "ToJsBuilder.h"
 #include "CppMethod.h"
 #include "SwigConfig.h"
+#include "Fingerprint.h"
+#include "Profiler.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
 
 namespace Cocos::Meta {
 
@@ -102,6 +107,7 @@ ModuleHandle::~ModuleHandle() {
 }
 
 void ModuleBuilder::init() {
+    PROFILE_SCOPE("init");
     mSyntaxGraph.mScratch = mScratch;
 }
 
@@ -132,6 +138,9 @@ ModuleGraph::vertex_descriptor ModuleBuilder::registerType(
 
 namespace {
 
+// written next to the engine-side graph headers, see generateGraphSupport_h
+constexpr std::string_view sGraphSupportHeader = "cocos/renderer/pipeline/custom/details/GraphSupport.h";
+
 void appendPath(std::pmr::string& currentPath, std::string_view name) {
     std::pmr::string validPath(name, currentPath.get_allocator());
     convertTypename(validPath);
@@ -910,7 +919,7 @@ void ModuleBuilder::addVertexMap(SyntaxGraph::vertex_descriptor vertID,
     }
     std::pmr::string typePath(scratch);
     {
-        pmr_ostringstream oss(std::ios::out, scratch);
+        CodeStream oss(scratch);
         oss << mapName << "<" << keyName << ",vertex_descriptor"
             << ">";
         typePath = oss.str();
@@ -939,10 +948,21 @@ void ModuleBuilder::addVertexBimap(SyntaxGraph::vertex_descriptor vertID,
     auto& s = get_by_tag<Graph_>(vertID, g);
 
     auto mapName = convertTypename(mapType, scratch);
+
+    // FrozenStringIndex is a string map that binary searches its sorted hashes once frozen,
+    // see FrozenStringMap in details/GraphSupport.h
+    const bool bFrozen = mapName == "FrozenStringIndex";
+    if (bFrozen) {
+        if (!g.isPmr(vertID)) {
+            throw std::invalid_argument("FrozenStringIndex: only pmr graph is supported");
+        }
+        mapName = "PmrFrozenStringMap";
+    }
+
     std::pmr::string keyName(scratch);
     for (const auto& c : s.mComponents) {
         if (c.mName == componentName) {
-            auto componentID = locate(c.mValuePath, g);
+            auto componentID = locate(c, g);
             if (componentMemberName.empty()) {
                 keyName = g.getDependentName(mCurrentScope, componentID, scratch, scratch);
             } else {
@@ -951,7 +971,7 @@ void ModuleBuilder::addVertexBimap(SyntaxGraph::vertex_descriptor vertID,
                     [&](const Composition_ auto& s) {
                         for (const auto& m : s.mMembers) {
                             if (m.mMemberName == componentMemberName) {
-                                auto memberID = locate(m.mTypePath, g);
+                                auto memberID = locate(m, g);
                                 keyName = g.getDependentName(mCurrentScope, memberID, scratch, scratch);
                                 break;
                             }
@@ -969,7 +989,7 @@ void ModuleBuilder::addVertexBimap(SyntaxGraph::vertex_descriptor vertID,
 
     std::pmr::string typePath(scratch);
     {
-        pmr_ostringstream oss(std::ios::out, scratch);
+        CodeStream oss(scratch);
         oss << mapName << "<" << keyName << ",vertex_descriptor"
             << ">";
         typePath = oss.str();
@@ -982,6 +1002,10 @@ void ModuleBuilder::addVertexBimap(SyntaxGraph::vertex_descriptor vertID,
     auto keyID = g.lookupType(mCurrentScope, keyName, scratch);
     auto keyPath = g.getTypePath(keyID, g.get_allocator().resource());
 
+    if (bFrozen && !g.isString(keyID)) {
+        throw std::invalid_argument("FrozenStringIndex: key must be a string");
+    }
+
     auto& map = s.mVertexMaps.emplace_back();
     map.mMapType = mapPath;
     map.mKeyType = keyPath;
@@ -1035,14 +1059,12 @@ std::pmr::string reorderIncludes(std::pmr::string content,
         return std::pmr::string(content, scratch);
     }
 
-    pmr_ostringstream oss(std::ios::out, scratch);
+    CodeStream oss(scratch);
 
-    std::istringstream iss(content);
     std::pmr::set<std::pmr::string> includes(scratch);
     std::pmr::set<std::pmr::string> includesHpp(scratch);
     std::pmr::set<std::pmr::string> includesStd(scratch);
     std::pmr::set<std::pmr::string> includesComma(scratch);
-    std::pmr::string line(scratch);
 
     auto outputIncludes = [&]() {
         for (const auto& line : includes) {
@@ -1063,14 +1085,14 @@ std::pmr::string reorderIncludes(std::pmr::string content,
         includesComma.clear();
     };
 
-    while (std::getline(iss, line)) {
+    forEachLine(content, [&](std::string_view line) {
         const std::string_view include = "#include";
         if (!line.starts_with(include)) {
             outputIncludes();
             oss << line << "\n";
         } else {
             auto content = line.substr(include.size());
-            boost::algorithm::trim(content);
+            content = boost::algorithm::trim_copy(content);
             if (content.starts_with("<") && content.ends_with(">")) {
                 if (content.ends_with(".hpp>")) {
                     includesHpp.emplace(line);
@@ -1083,9 +1105,9 @@ std::pmr::string reorderIncludes(std::pmr::string content,
                 includesComma.emplace(line);
             }
         }
-    }
+    });
     outputIncludes();
-    return oss.str();
+    return oss.release();
 }
 
 void outputComment(std::ostream& oss) {
@@ -1125,13 +1147,217 @@ void outputComment(std::ostream& oss) {
 }
 
 void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::string>& files) const {
-    auto scratch = mScratch;
     Expects(!name.empty());
 
     auto moduleID = locate(mModuleGraph.null_vertex(), name, mModuleGraph);
     if (moduleID == mModuleGraph.null_vertex())
         return;
 
+    const auto& m = get(mModuleGraph.modules, mModuleGraph, moduleID);
+    outputModuleFeatures(moduleID, m.mFeatures, files, mScratch);
+}
+
+std::pmr::vector<std::string_view> ModuleBuilder::outputModules(
+    std::span<const std::string_view> names,
+    std::pmr::set<std::pmr::string>& files, uint32_t numThreads) const {
+    PROFILE_SCOPE("outputModules");
+    const auto& mg = mModuleGraph;
+
+    // modules whose fingerprint and features match the previous run,
+    // and whose files are unchanged on disk, are not emitted again.
+    // Without a build id, emitter changes cannot be detected, so every module is emitted.
+    const bool bIncremental = !mFingerprintFile.empty() && getGeneratorBuildID() != 0;
+    PmrMap<std::pmr::string, ModuleFingerprint> fingerprints(mScratch);
+    PmrMap<std::pmr::string, ModuleFingerprint> cached(mScratch);
+    if (bIncremental) {
+        PROFILE_SCOPE("fingerprints");
+        fingerprints = getModuleFingerprints(*this, mScratch);
+        cached = readFingerprints(mFingerprintFile, mScratch);
+    }
+
+    // every feature of a module is written to its own files,
+    // so each (module, feature) pair is an independent task
+    std::pmr::vector<std::pair<ModuleGraph::vertex_descriptor, Features>> tasks(mScratch);
+    std::pmr::vector<std::string_view> skipped(mScratch);
+    for (const auto& name : names) {
+        Expects(!name.empty());
+        auto moduleID = locate(mg.null_vertex(), name, mg);
+        if (moduleID == mg.null_vertex())
+            continue;
+        const auto& m = get(mg.modules, mg, moduleID);
+        if (bIncremental) {
+            const auto modulePath = get_path(moduleID, mg, mScratch);
+            const auto& fingerprint = fingerprints.at(modulePath);
+            auto iter = cached.find(modulePath);
+            if (iter != cached.end()
+                && iter->second.mFeatures == fingerprint.mFeatures
+                && iter->second.mFingerprint == fingerprint.mFingerprint
+                && iter->second.mOutputs != 0
+                && iter->second.mOutputs == hashOutputFiles(getModuleOutputs(moduleID, m.mFeatures, mScratch))) {
+                collectModuleFiles(moduleID, m.mFeatures, files);
+                skipped.emplace_back(name);
+                continue;
+            }
+        }
+        for (uint32_t bit = Features::Fwd; bit <= Features::Interface; bit <<= 1) {
+            const auto feature = static_cast<Features>(bit);
+            if (m.mFeatures & feature) {
+                tasks.emplace_back(moduleID, feature);
+            }
+        }
+    }
+
+    numThreads = std::min(numThreads, gsl::narrow_cast<uint32_t>(tasks.size()));
+    if (numThreads <= 1) {
+        for (const auto& [moduleID, feature] : tasks) {
+            outputModuleFeatures(moduleID, feature, files, mScratch);
+        }
+    } else {
+        std::atomic<size_t> nextTask = 0;
+        std::mutex filesMutex;
+        std::exception_ptr error;
+
+        auto worker = [&]() {
+            // mScratch is not synchronized, each thread generates into its own pool
+            std::pmr::unsynchronized_pool_resource pool;
+#if CC_GENERATOR_PROFILE
+            ProfileMemoryResource profiled(&pool);
+            std::pmr::memory_resource* scratch = &profiled;
+#else
+            std::pmr::memory_resource* scratch = &pool;
+#endif
+            std::pmr::set<std::pmr::string> localFiles(scratch);
+            try {
+                for (auto i = nextTask++; i < tasks.size(); i = nextTask++) {
+                    const auto& [moduleID, feature] = tasks[i];
+                    outputModuleFeatures(moduleID, feature, localFiles, scratch);
+                }
+            } catch (...) {
+                nextTask = tasks.size();
+                std::lock_guard<std::mutex> lock(filesMutex);
+                if (!error) {
+                    error = std::current_exception();
+                }
+            }
+            std::lock_guard<std::mutex> lock(filesMutex);
+            for (const auto& file : localFiles) {
+                files.emplace(file);
+            }
+        };
+
+        std::vector<std::thread> threads;
+        threads.reserve(numThreads - 1);
+        for (uint32_t i = 1; i != numThreads; ++i) {
+            threads.emplace_back(worker);
+        }
+        worker();
+        for (auto& t : threads) {
+            t.join();
+        }
+
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+
+    // the helpers are shared by all graphs, and are not covered by the fingerprints
+    for (const auto& name : names) {
+        auto moduleID = locate(mg.null_vertex(), name, mg);
+        if (moduleID == mg.null_vertex())
+            continue;
+        const auto& m = get(mg.modules, mg, moduleID);
+        const auto modulePath = get_path(moduleID, mg, mScratch);
+        if ((m.mFeatures & Features::Types)
+            && (mSyntaxGraph.moduleHasGraph(modulePath)
+                || mSyntaxGraph.moduleHasMap(modulePath, "/cc/PmrFrozenStringMap"))) {
+            CodeStream oss(mScratch);
+            outputComment(oss);
+            oss << generateGraphSupport_h(mScratch);
+            updateFile(mCppFolder / sGraphSupportHeader, oss.str());
+            files.emplace(sGraphSupportHeader);
+            break;
+        }
+    }
+
+    // only record fingerprints after the files are written successfully
+    if (bIncremental) {
+        for (const auto& name : names) {
+            auto moduleID = locate(mg.null_vertex(), name, mg);
+            if (moduleID == mg.null_vertex())
+                continue;
+            const auto& m = get(mg.modules, mg, moduleID);
+            auto modulePath = get_path(moduleID, mg, mScratch);
+            auto& fingerprint = cached[modulePath];
+            fingerprint = fingerprints.at(modulePath);
+            fingerprint.mOutputs = hashOutputFiles(getModuleOutputs(moduleID, m.mFeatures, mScratch));
+        }
+        writeFingerprints(mFingerprintFile, cached);
+    }
+
+    return skipped;
+}
+
+void ModuleBuilder::collectModuleFiles(ModuleGraph::vertex_descriptor moduleID, Features outputs,
+    std::pmr::set<std::pmr::string>& files) const {
+    const auto& m = get(mModuleGraph.modules, mModuleGraph, moduleID);
+    auto addFile = [&](std::string_view suffix) {
+        std::pmr::string shortname(m.mFolder, files.get_allocator().resource());
+        shortname.append("/");
+        shortname.append(m.mFilePrefix);
+        shortname.append(suffix);
+        files.emplace(std::move(shortname));
+    };
+    if (outputs & Features::Fwd) {
+        addFile("Fwd.h");
+    }
+    if (outputs & Features::Names) {
+        addFile("Names.h");
+    }
+    if (outputs & Features::Types) {
+        addFile("Types.h");
+        addFile("Types.cpp");
+    }
+    if (outputs & Features::Graphs) {
+        addFile("Graphs.h");
+    }
+    if (outputs & Features::Reflection) {
+        addFile("Reflection.h");
+        addFile("Reflection.cpp");
+    }
+    if (outputs & Features::Jsb) {
+        addFile("Jsb.h");
+        addFile("Jsb.cpp");
+    }
+    if (outputs & Features::Serialization) {
+        addFile("Serialization.h");
+    }
+}
+
+std::pmr::vector<std::filesystem::path> ModuleBuilder::getModuleOutputs(
+    ModuleGraph::vertex_descriptor moduleID, Features outputs,
+    std::pmr::memory_resource* scratch) const {
+    const auto& m = get(mModuleGraph.modules, mModuleGraph, moduleID);
+    std::pmr::set<std::pmr::string> files(scratch);
+    collectModuleFiles(moduleID, outputs, files);
+
+    std::pmr::vector<std::filesystem::path> paths(scratch);
+    for (const auto& file : files) {
+        paths.emplace_back(mCppFolder / file);
+    }
+    if (outputs & Features::ToJs) {
+        paths.emplace_back(mCppFolder / "tools/swig-config" / m.mToJsFilename);
+    }
+    if (outputs & Features::Typescripts) {
+        auto& filename = paths.emplace_back(mTypescriptFolder / m.mTypescriptFolder / m.mTypescriptFilePrefix);
+        filename += ".ts";
+    }
+    return paths;
+}
+
+void ModuleBuilder::outputModuleFeatures(ModuleGraph::vertex_descriptor moduleID, Features outputs,
+    std::pmr::set<std::pmr::string>& files, std::pmr::memory_resource* scratch) const {
+    ThreadScratchScope scratchScope(scratch);
+
     const auto& g = mSyntaxGraph;
     const auto& mg = mModuleGraph;
 
@@ -1146,11 +1372,13 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
     const auto& cppFolder = mCppFolder;
     auto ccFolder = std::string_view(m.mFolder);
 
-    if (features & Features::Fwd) {
+    collectModuleFiles(moduleID, outputs, files);
+
+    if (outputs & Features::Fwd) {
+        PROFILE_SCOPE("output Fwd", modulePath);
         std::pmr::string shortname(m.mFolder + "/" + m.mFilePrefix + "Fwd.h" , scratch);
         std::filesystem::path filename = cppFolder / shortname;
-        files.emplace(std::move(shortname));
-        pmr_ostringstream oss(std::ios_base::out, scratch);
+        CodeStream oss(scratch);
         std::pmr::string space(scratch);
         outputComment(oss);
         OSS << "// clang-format off\n";
@@ -1175,14 +1403,14 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
         oss << "\n";
         OSS << "// clang-format on\n";
 
-        updateFile(filename, reorderIncludes(oss.str(), scratch));
+        updateFile(filename, reorderIncludes(oss.release(), scratch));
     }
 
-    if (features & Features::Names) {
+    if (outputs & Features::Names) {
+        PROFILE_SCOPE("output Names", modulePath);
         std::pmr::string shortname(m.mFolder + "/" + m.mFilePrefix + "Names.h", scratch);
         std::filesystem::path filename = cppFolder / shortname;
-        files.emplace(std::move(shortname));
-        pmr_ostringstream oss(std::ios_base::out, scratch);
+        CodeStream oss(scratch);
         std::pmr::string space(scratch);
         outputComment(oss);
         OSS << "// clang-format off\n";
@@ -1202,20 +1430,18 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
         copyString(oss, generateNames_h(mSyntaxGraph, mModuleGraph, modulePath, scratch, scratch));
         oss << "\n";
         OSS << "// clang-format on\n";
-        updateFile(filename, reorderIncludes(oss.str(), scratch));
+        updateFile(filename, reorderIncludes(oss.release(), scratch));
     }
 
-    if (features & Features::Types) {
-        std::pmr::string shortname(m.mFolder + "/" + m.mFilePrefix + "Types.h", scratch);
-        files.emplace(std::move(shortname));
-
+    if (outputs & Features::Types) {
+        PROFILE_SCOPE("output Types", modulePath);
         const std::filesystem::path filename = cppFolder / m.mFolder / m.mFilePrefix;
 
         {
             auto filename1 = filename;
             filename1 += "Types.h";
 
-            pmr_ostringstream oss(std::ios_base::out, scratch);
+            CodeStream oss(scratch);
             std::pmr::string space(scratch);
             outputComment(oss);
             OSS << "// clang-format off\n";
@@ -1252,6 +1478,9 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
                 OSS << "#include <boost/range/irange.hpp>\n";
                 OSS << "#include \"cocos/base/std/container/vector.h\"\n";
                 OSS << "#include \"cocos/renderer/pipeline/custom/details/GraphTypes.h\"\n";
+                OSS << "#include \"" << sGraphSupportHeader << "\"\n";
+            } else if (g.moduleHasMap(modulePath, "/cc/PmrFrozenStringMap")) {
+                OSS << "#include \"" << sGraphSupportHeader << "\"\n";
             }
             if (g.moduleHasMap(modulePath, "/ccstd/pmr/map")) {
                 OSS << "#include \"base/std/container/map.h\"\n";
@@ -1294,6 +1523,14 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
             if (g.moduleHasContainer(modulePath, "/boost/container/pmr/list")) {
                 OSS << "#include <boost/container/pmr/list.hpp>\n";
             }
+            if (g.moduleHasSmallEdgeList(modulePath)) {
+                OSS << "#include <boost/container/pmr/small_vector.hpp>\n";
+            }
+            if (g.moduleHasSlotMap(modulePath)) {
+                OSS << "#include <boost/iterator/counting_iterator.hpp>\n";
+                OSS << "#include <boost/iterator/filter_iterator.hpp>\n";
+                OSS << "#include <boost/range/iterator_range.hpp>\n";
+            }
             if (g.moduleUsesHashCombine(modulePath)) {
                 OSS << "#include \"cocos/base/std/hash/hash.h\"\n";
             }
@@ -1306,17 +1543,14 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
             if (!moduleInfo.mTail.empty()) {
                 copyCppString(oss, space, moduleInfo.mTail);
             }
-            updateFile(filename1, reorderIncludes(oss.str(), scratch));
+            updateFile(filename1, reorderIncludes(oss.release(), scratch));
         }
 
         {
-            std::pmr::string shortname(m.mFolder + "/" + m.mFilePrefix + "Types.cpp", scratch);
-            files.emplace(std::move(shortname));
-
             auto filename1 = filename;
             filename1 += "Types.cpp";
 
-            pmr_ostringstream oss(std::ios_base::out, scratch);
+            CodeStream oss(scratch);
             std::pmr::string space(scratch);
             outputComment(oss);
             OSS << "// clang-format off\n";
@@ -1325,17 +1559,15 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
             copyString(oss, generateTypes_cpp(mProjectName, mSyntaxGraph, mModuleGraph, modulePath, scratch, scratch));
             oss << "\n";
             OSS << "// clang-format on\n";
-            updateFile(filename1, reorderIncludes(oss.str(), scratch));
+            updateFile(filename1, reorderIncludes(oss.release(), scratch));
         }
     }
-    if (features & Features::Graphs) {
-        std::pmr::string shortname(m.mFolder + "/" + m.mFilePrefix + "Graphs.h", scratch);
-        files.emplace(std::move(shortname));
-
+    if (outputs & Features::Graphs) {
+        PROFILE_SCOPE("output Graphs", modulePath);
         std::filesystem::path filename = cppFolder / m.mFolder / m.mFilePrefix;
         filename += "Graphs.h";
 
-        pmr_ostringstream oss(std::ios_base::out, scratch);
+        CodeStream oss(scratch);
         std::pmr::string space(scratch);
         outputComment(oss);
         OSS << "// clang-format off\n";
@@ -1350,17 +1582,15 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
         copyString(oss, generateGraphs_h(mProjectName, mSyntaxGraph, mModuleGraph, modulePath, scratch, scratch));
         oss << "\n";
         OSS << "// clang-format on\n";
-        updateFile(filename, reorderIncludes(oss.str(), scratch));
+        updateFile(filename, reorderIncludes(oss.release(), scratch));
     }
-    if (features & Features::Reflection) {
+    if (outputs & Features::Reflection) {
+        PROFILE_SCOPE("output Reflection", modulePath);
         {
-            std::pmr::string shortname(m.mFolder + "/" + m.mFilePrefix + "Reflection.h", scratch);
-            files.emplace(std::move(shortname));
-
             std::filesystem::path filename = cppFolder / m.mFolder / m.mFilePrefix;
             filename += "Reflection.h";
 
-            pmr_ostringstream oss(std::ios_base::out, scratch);
+            CodeStream oss(scratch);
             std::pmr::string space(scratch);
             outputComment(oss);
             OSS << "// clang-format off\n";
@@ -1388,16 +1618,13 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
             copyString(oss, generateReflection_h(mProjectName, mSyntaxGraph, mModuleGraph, modulePath, scratch, scratch));
             oss << "\n";
             OSS << "// clang-format on\n";
-            updateFile(filename, reorderIncludes(oss.str(), scratch));
+            updateFile(filename, reorderIncludes(oss.release(), scratch));
         }
         {
-            std::pmr::string shortname(m.mFolder + "/" + m.mFilePrefix + "Reflection.cpp", scratch);
-            files.emplace(std::move(shortname));
-
             std::filesystem::path filename = cppFolder / m.mFolder / m.mFilePrefix;
             filename += "Reflection.cpp";
 
-            pmr_ostringstream oss(std::ios_base::out, scratch);
+            CodeStream oss(scratch);
             std::pmr::string space(scratch);
             outputComment(oss);
             OSS << "// clang-format off\n";
@@ -1407,19 +1634,18 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
             copyString(oss, generateReflection_cpp(mProjectName, mSyntaxGraph, mModuleGraph, modulePath, scratch, scratch));
             oss << "\n";
             OSS << "// clang-format on\n";
-            updateFile(filename, reorderIncludes(oss.str(), scratch));
+            updateFile(filename, reorderIncludes(oss.release(), scratch));
         }
     }
 
-    if (features & Features::Jsb) {
-        std::pmr::string shortname(m.mFolder + "/" + m.mFilePrefix + "Jsb.h", scratch);
-        files.emplace(std::move(shortname));
+    if (outputs & Features::Jsb) {
+        PROFILE_SCOPE("output Jsb", modulePath);
         const std::filesystem::path filename = cppFolder / m.mFolder / m.mFilePrefix;
         {
             auto filename1 = filename;
             filename1 += "Jsb.h";
 
-            pmr_ostringstream oss(std::ios_base::out, scratch);
+            CodeStream oss(scratch);
             std::pmr::string space(scratch);
             outputComment(oss);
             OSS << "// clang-format off\n";
@@ -1446,17 +1672,14 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
             copyString(oss, generateJsbConversions_h(*this, moduleID));
             oss << "\n";
             OSS << "// clang-format on\n";
-            updateFile(filename1, reorderIncludes(oss.str(), scratch));
+            updateFile(filename1, reorderIncludes(oss.release(), scratch));
         }
 
         {
-            std::pmr::string shortname(m.mFolder + "/" + m.mFilePrefix + "Jsb.cpp", scratch);
-            files.emplace(std::move(shortname));
-
             auto filename1 = filename;
             filename1 += "Jsb.cpp";
 
-            pmr_ostringstream oss(std::ios_base::out, scratch);
+            CodeStream oss(scratch);
             std::pmr::string space(scratch);
             outputComment(oss);
             OSS << "// clang-format off\n";
@@ -1467,11 +1690,11 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
             copyString(oss, generateJsbConversions_cpp(*this, moduleID));
             oss << "\n";
             OSS << "// clang-format on\n";
-            updateFile(filename1, reorderIncludes(oss.str(), scratch));
+            updateFile(filename1, reorderIncludes(oss.release(), scratch));
         }
     }
 
-    if (false && (features & Features::ToJs)) {
+    if (false && (outputs & Features::ToJs)) {
         // we must manually update
         // 1. CMakeLists
         // 2. tools/bindings-generator/conversions.yaml
@@ -1489,7 +1712,8 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
         updateFile(filename, oss.str());
     }
 
-    if (features & Features::ToJs) {
+    if (outputs & Features::ToJs) {
+        PROFILE_SCOPE("output ToJs", modulePath);
         Expects(!m.mToJsFilename.empty());
         Expects(!m.mToJsPrefix.empty());
         Expects(!m.mToJsNamespace.empty());
@@ -1503,11 +1727,12 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
         updateFile(filename, oss.str());
     }
 
-    if (features & Features::Typescripts) {
+    if (outputs & Features::Typescripts) {
+        PROFILE_SCOPE("output Typescripts", modulePath);
         std::filesystem::path tsPath = typescriptFolder / m.mTypescriptFolder / m.mTypescriptFilePrefix;
         std::filesystem::path filename = tsPath;
         filename += ".ts";
-        pmr_ostringstream oss(std::ios_base::out, scratch);
+        CodeStream oss(scratch);
         std::pmr::string space(scratch);
         CodegenContext codegen(scratch);
         codegen.mScopes.emplace_back("Struct");
@@ -1555,10 +1780,7 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
                 oss << "\n";
         }
 
-        for (const auto& vertID : make_range(vertices(g))) {
-            const auto& typeModulePath = get(g.modulePaths, g, vertID);
-            if (typeModulePath != modulePath)
-                continue;
+        for (const auto& vertID : g.getModuleVertices(modulePath)) {
             outputTypescript(oss, space, codegen, *this, "", vertID, graphImports, scratch);
         }
 
@@ -1624,7 +1846,7 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
 
         codegen.mScopes.pop_back();
 
-        pmr_ostringstream oss2(std::ios_base::out, scratch);
+        CodeStream oss2(scratch);
         outputComment(oss2);
         oss2 << "/* eslint-disable max-len */\n";
         if (graphImports.empty()) {
@@ -1646,11 +1868,10 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
         updateFile(filename, oss2.str());
     }
 
-    if (features & Features::Serialization) {
+    if (outputs & Features::Serialization) {
         std::pmr::string shortname(m.mFolder + "/" + m.mFilePrefix + "Serialization.h", scratch);
         std::filesystem::path filename = cppFolder / shortname;
-        files.emplace(std::move(shortname));
-        pmr_ostringstream oss(std::ios_base::out, scratch);
+        CodeStream oss(scratch);
         std::pmr::string space(scratch);
         outputComment(oss);
         OSS << "#pragma once\n";
@@ -1674,7 +1895,7 @@ void ModuleBuilder::outputModule(std::string_view name, std::pmr::set<std::pmr::
         OSS << "#include \"" << ccFolder << "/details/Range.h\"\n";
         copyString(oss, generateSerialization_h(mProjectName, mSyntaxGraph,
             mModuleGraph, modulePath, false, scratch, scratch));
-        updateFile(filename, reorderIncludes(oss.str(), scratch));
+        updateFile(filename, reorderIncludes(oss.release(), scratch));
     }
 }
 
@@ -1798,6 +2019,7 @@ void ModuleBuilder::projectTypescript(std::string_view cpp, std::string_view ts)
 
 // Generation
 int ModuleBuilder::compile() {
+    PROFILE_SCOPE("compile");
     auto& g = mSyntaxGraph;
     auto scratch = mScratch;
 
@@ -1837,7 +2059,16 @@ int ModuleBuilder::compile() {
                     s.mVertexListPath = "/ccstd/pmr/vector";
                 }
                 if (s.mEdgeListPath.empty()) {
-                    s.mEdgeListPath = "/cc/PmrList";
+                    // edges are pooled in blocks, see EdgePool in details/GraphSupport.h.
+                    // edges(g) follows slot order instead of insertion order.
+                    if (holds_alternative<List_>(s.mEdgeListType)) {
+                        s.mEdgeListType = Pool_{};
+                    }
+                    if (holds_alternative<Pool_>(s.mEdgeListType)) {
+                        s.mEdgeListPath = "/cc/PmrEdgePool";
+                    } else {
+                        s.mEdgeListPath = "/cc/PmrList";
+                    }
                 }
                 if (s.mOutEdgeListPath.empty()) {
                     s.mOutEdgeListPath = "/ccstd/pmr/vector";
@@ -1853,6 +2084,26 @@ int ModuleBuilder::compile() {
                     s.mOutEdgeListPath = "/std/vector";
                 }
             }
+
+            // compact descriptors shrink edge lists and handles,
+            // sizes and differences follow the descriptor width
+            if (!s.mVertexDescriptor.empty()) {
+                if (!s.isVector()) {
+                    throw std::invalid_argument("DESCRIPTOR_TYPE: only vector graph is supported");
+                }
+                if (s.mVertexDescriptor == "uint16_t") {
+                    s.mVertexSizeType = "uint16_t";
+                    s.mDifferenceType = "int16_t";
+                } else if (s.mVertexDescriptor == "uint32_t") {
+                    s.mVertexSizeType = "uint32_t";
+                    s.mDifferenceType = "int32_t";
+                } else if (s.mVertexDescriptor == "uint64_t") {
+                    s.mVertexSizeType = "uint64_t";
+                    s.mDifferenceType = "int64_t";
+                } else {
+                    throw std::invalid_argument("DESCRIPTOR_TYPE: must be uint16_t, uint32_t or uint64_t");
+                }
+            }
         }
 
         // copy graph, vertex might be invalidated
@@ -1865,6 +2116,15 @@ int ModuleBuilder::compile() {
                 if (s.mBidirectional) {
                     addAlias("InEdge", "");
                 }
+                if (s.hasSmallEdgeList()) {
+                    // the inline capacity is not a type, the list is declared in the graph
+                    auto listID = addAlias("OutEdgeList", "");
+                    get(g.traits, g, listID).mPmr = g.isPmr(vertID);
+                    if (s.mBidirectional) {
+                        listID = addAlias("InEdgeList", "");
+                        get(g.traits, g, listID).mPmr = g.isPmr(vertID);
+                    }
+                }
             }
             if (s.mReferenceGraph && !s.mAliasGraph) {
                 addAlias("ChildEdge", "");
@@ -1942,8 +2202,8 @@ int ModuleBuilder::compile() {
             if (i == 0)
                 comments = R"(// Components
 )";
-            auto memberID = locate(c.mValuePath, g);
-            pmr_ostringstream oss(std::ios::out, scratch);
+            auto memberID = locate(c, g);
+            CodeStream oss(scratch);
             auto typeName = g.getDependentName(mCurrentScope, memberID, scratch, scratch);
             auto listID = locate(builder.componentContainerType(), g);
             oss << g.getDependentName(mCurrentScope, listID, scratch, scratch);
@@ -1960,8 +2220,8 @@ int ModuleBuilder::compile() {
             if (count++ == 0)
                 comments = R"(// PolymorphicGraph
 )";
-            auto conceptID = locate(c.mValue, g);
-            pmr_ostringstream oss(std::ios::out, scratch);
+            auto conceptID = locate(c, g);
+            CodeStream oss(scratch);
             auto typeName = g.getDependentName(mCurrentScope, conceptID, scratch, scratch);
             auto listID = g.null_vertex();
             if (bPmr) {
@@ -1981,8 +2241,117 @@ int ModuleBuilder::compile() {
         if (s.needEdgeList()) {
             addMember(vertID, true, builder.edgeListType(), "mEdges", "_",
                 NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT,
-                R"(// Edges
+                holds_alternative<Pool_>(s.mEdgeListType)
+                    ? R"(// Edges, pooled in blocks, edges(g) follows slot order
+)"
+                    : R"(// Edges
+)");
+        }
+
+        if (s.mCsrFreeze) {
+            if (!s.isFreezable()) {
+                throw std::invalid_argument("CSR_FREEZE: graph must be a vector graph without edge properties");
+            }
+            addMember(vertID, true, builder.frozenOffsetListType(), "mFrozenOutOffsets", "_",
+                NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT,
+                R"(// FrozenGraph
 )");
+            addMember(vertID, true, builder.outEdgeListType(), "mFrozenOutEdges", "_",
+                NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT);
+            if (s.mBidirectional) {
+                addMember(vertID, true, builder.frozenOffsetListType(), "mFrozenInOffsets", "_",
+                    NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT);
+                addMember(vertID, true, builder.inEdgeListType(), "mFrozenInEdges", "_",
+                    NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT);
+            }
+        }
+
+        if (s.mFragment) {
+            if (!s.isMergeable()) {
+                throw std::invalid_argument("FRAGMENT_GRAPH: graph must be a vector graph without edge properties");
+            }
+            for (const auto& c : s.mPolymorphic.mConcepts) {
+                if (!c.isVector() && !c.isIntrusive()) {
+                    throw std::invalid_argument("FRAGMENT_GRAPH: only vector polymorphic values are merged");
+                }
+            }
+        }
+
+        if (s.mLevels) {
+            // levels are indexed by descriptor, slot maps keep dead slots
+            if (!s.isVector() || s.isSlotMap()) {
+                throw std::invalid_argument("LEVEL_GRAPH: only vector graph is supported");
+            }
+            if (!s.mIncidence || s.mUndirected) {
+                throw std::invalid_argument("LEVEL_GRAPH: graph must be directed");
+            }
+        }
+
+        if (s.mOrderedDag) {
+            if (!s.isVector() || s.isSlotMap()) {
+                throw std::invalid_argument("ORDERED_DAG_GRAPH: only vector graph is supported");
+            }
+            if (!s.mIncidence || s.mUndirected || !s.mBidirectional || !s.mMutableGraphEdge) {
+                throw std::invalid_argument("ORDERED_DAG_GRAPH: graph must be bidirectional with mutable edges");
+            }
+            if (s.mFragment) {
+                throw std::invalid_argument("ORDERED_DAG_GRAPH: fragment graph not supported yet");
+            }
+            // the vertex at each position, and the position of each vertex
+            addMember(vertID, false, builder.slotListType("vertex_descriptor"), "mDagOrder", "_",
+                NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT,
+                R"(// OrderedDag
+)");
+            addMember(vertID, false, builder.slotListType("vertex_descriptor"), "mDagRanks", "_",
+                NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT);
+        }
+
+        if (s.mObjectRanges) {
+            if (!s.isVector() || s.isSlotMap()) {
+                throw std::invalid_argument("OBJECT_RANGES: only vector graph is supported");
+            }
+            if (!s.isPolymorphic()) {
+                throw std::invalid_argument("OBJECT_RANGES: graph must be polymorphic");
+            }
+            // the vertex of each object, in the order of the objects
+            int count = 0;
+            for (const auto& c : s.mPolymorphic.mConcepts) {
+                if (!s.hasObjectVertices(c)) {
+                    continue;
+                }
+                std::string_view comments;
+                if (count++ == 0)
+                    comments = R"(// ObjectRanges
+)";
+                addMember(vertID, false, builder.slotListType("vertex_descriptor"),
+                    getObjectVerticesName(c.mTag, scratch), "_",
+                    NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT, comments);
+            }
+        }
+
+        if (s.isSlotMap()) {
+            if (s.hasVertexProperty()) {
+                throw std::invalid_argument("SLOT_MAP: vertex property not supported yet");
+            }
+            for (const auto& c : s.mPolymorphic.mConcepts) {
+                if (!c.isVector() || c.isIntrusive()) {
+                    throw std::invalid_argument("SLOT_MAP: only vector polymorphic values are recycled");
+                }
+            }
+            addMember(vertID, false, builder.slotListType("uint32_t"), "mGenerations", "_",
+                NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT,
+                R"(// SlotMap
+)");
+            if (s.isPolymorphic()) {
+                // free slots are recycled per value type
+                addMember(vertID, false, builder.slotListType("vertex_descriptor"), "mFreeHeads", "_",
+                    NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT);
+                addMember(vertID, false, builder.slotListType("vertex_descriptor"), "mFreeLinks", "_",
+                    NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT);
+            } else {
+                addMember(vertID, false, builder.slotListType("vertex_descriptor"), "mFreeSlots", "_",
+                    NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT);
+            }
         }
 
         for (int count = 0; const auto& map : s.mVertexMaps) {
@@ -2005,24 +2374,25 @@ int ModuleBuilder::compile() {
             visit(
                 overload(
                     [&](Map_) {
-                        std::pmr::string indexName(scratch);
-                        if (bPmr) {
-                            if (s.mAddressableConcept.mUtf8) {
-                                indexName = "PmrTransparentMap<ccstd::pmr::u8string, vertex_descriptor>";
-                            } else {
-                                indexName = "PmrTransparentMap<ccstd::pmr::string, vertex_descriptor>";
-                            }
-                        } else {
-                            if (s.mAddressableConcept.mUtf8) {
-                                indexName = "TransparentMap<ccstd::u8string, vertex_descriptor>";
-                            } else {
-                                indexName = "TransparentMap<ccstd::string, vertex_descriptor>";
-                            }
-                        }
-                        addMember(vertID, true, indexName,
+                        addMember(vertID, true, builder.pathIndexType(),
                             s.mAddressableConcept.mMemberName,
                             "_", NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT, "// Path\n");
                     },
+                    [&](Trie_) {
+                        if (!s.isVector()) {
+                            throw std::invalid_argument("PATH_TRIE: only vector graph is supported");
+                        }
+                        if (s.mAddressableConcept.mPathPropertyMap) {
+                            throw std::invalid_argument("PATH_TRIE: path property map not supported");
+                        }
+                        // top level segments, and the segments under each vertex
+                        addMember(vertID, true, builder.pathIndexType(),
+                            s.mAddressableConcept.mMemberName,
+                            "_", NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT, "// Path (Trie)\n");
+                        addMember(vertID, true, builder.slotListType(builder.pathIndexType()),
+                            "mPathChildren",
+                            "_", NO_SERIALIZATION | IMPL_DETAIL | NOT_ELEMENT);
+                    },
                     [&](auto) {
                     }),
                 s.mAddressableConcept.mType);
@@ -2031,6 +2401,10 @@ int ModuleBuilder::compile() {
     mCurrentScope.clear();
     mCurrentModule.clear();
 
+    g.bindSymbols();
+    g.buildModuleIndex();
+    g.mNameCache.enable();
+
     mCompiled = true;
     return 0;
 }
@@ -2038,9 +2412,9 @@ int ModuleBuilder::compile() {
 std::pmr::string ModuleBuilder::getTypedMemberName(
     const Member& m, bool bPublic, bool bFull) const {
     const auto& g = mSyntaxGraph;
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
 
-    auto memberID = locate(m.mTypePath, g);
+    auto memberID = locate(m, g);
     auto typeName = g.getTypescriptTypename(memberID, scratch, scratch);
 
     auto name = g.getMemberName(m.mMemberName, bPublic);
@@ -2059,9 +2433,9 @@ std::pmr::string ModuleBuilder::getTypedMemberName(
 std::pmr::string ModuleBuilder::getTypedParameterName(const Parameter& p,
     bool bPublic, bool bFull, bool bOptional) const {
     const auto& g = mSyntaxGraph;
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
 
-    auto memberID = locate(p.mTypePath, g);
+    auto memberID = locate(p, g);
     auto typeName = g.getTypescriptTypename(memberID, scratch, scratch);
     Expects(!typeName.empty());
 
@@ -2082,8 +2456,8 @@ std::pmr::string ModuleBuilder::getTypedParameterName(const Parameter& p,
 
 std::pmr::string ModuleBuilder::getTypescriptVertexName(SyntaxGraph::vertex_descriptor vertID,
     std::string_view descName) const {
-    auto scratch = get_allocator().resource();
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    auto scratch = getThreadScratch(get_allocator().resource());
+    CodeStream oss(scratch);
     const auto& g = mSyntaxGraph;
     const auto& s = get<Graph>(vertID, g);
     const auto& builder = *this;
@@ -2114,7 +2488,7 @@ std::pmr::string ModuleBuilder::getTypescriptVertexName(SyntaxGraph::vertex_desc
         }
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 }
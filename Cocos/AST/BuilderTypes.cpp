@@ -114,6 +114,7 @@ ModuleBuilder::ModuleBuilder(std::string_view projectName, std::filesystem::path
 ModuleBuilder::ModuleBuilder(ModuleBuilder&& rhs, const allocator_type& alloc)
     : mCppFolder(std::move(rhs.mCppFolder))
     , mTypescriptFolder(std::move(rhs.mTypescriptFolder))
+    , mFingerprintFile(std::move(rhs.mFingerprintFile))
     , mSyntaxGraph(std::move(rhs.mSyntaxGraph), alloc)
     , mModuleGraph(std::move(rhs.mModuleGraph), alloc)
     , mCurrentModule(std::move(rhs.mCurrentModule), alloc)
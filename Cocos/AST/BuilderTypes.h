@@ -129,6 +129,10 @@ public:
     virtual std::pmr::string inEdgeListType(std::string_view ns = ".") const = 0;
     virtual std::pmr::string inEdgeType(std::string_view ns = ".") const = 0;
     virtual std::pmr::string inIterType() const = 0;
+    virtual std::pmr::string frozenOffsetListType(std::string_view ns = ".") const = 0;
+    virtual std::pmr::string smallEdgeListType(std::string_view edgeType) const = 0;
+    virtual std::pmr::string slotListType(std::string_view elemType, std::string_view ns = ".") const = 0;
+    virtual std::pmr::string pathIndexType(std::string_view vertexDescriptor = "vertex_descriptor") const = 0;
     virtual std::pmr::string edgeIterType() const = 0;
     virtual std::pmr::string childListType(std::string_view ns = ".") const = 0;
     virtual std::pmr::string childEdgeType(std::string_view ns = ".") const = 0;
@@ -172,10 +176,16 @@ public:
     virtual std::pmr::string generatePolymorphicGraph_h() const = 0;
     virtual std::pmr::string generateMemberFunctions_h() const = 0;
     virtual std::pmr::string generateReserve_h() const = 0;
+    virtual std::pmr::string generateFrozenGraph_h() const = 0;
+    virtual std::pmr::string generateSlotMap_h() const = 0;
+    virtual std::pmr::string generateReset_h() const = 0;
+    virtual std::pmr::string generateFragment_h() const = 0;
     virtual std::pmr::string generateTags_h() const = 0;
     virtual std::pmr::string generateMembers_h() const = 0;
 
     virtual std::pmr::string generateReserve_cpp() const = 0;
+    virtual std::pmr::string generateFrozenGraph_cpp() const = 0;
+    virtual std::pmr::string generateReset_cpp() const = 0;
 
     virtual std::pmr::string generateAddEdge(bool property,
         bool cntr, bool variadic, bool reference, bool function = true) const = 0;
@@ -223,6 +233,10 @@ public:
     std::pmr::string inEdgeListType(std::string_view ns = ".") const override;
     std::pmr::string inEdgeType(std::string_view ns = ".") const override;
     std::pmr::string inIterType() const override;
+    std::pmr::string frozenOffsetListType(std::string_view ns = ".") const override;
+    std::pmr::string smallEdgeListType(std::string_view edgeType) const override;
+    std::pmr::string slotListType(std::string_view elemType, std::string_view ns = ".") const override;
+    std::pmr::string pathIndexType(std::string_view vertexDescriptor = "vertex_descriptor") const override;
     std::pmr::string edgeIterType() const override;
     std::pmr::string childListType(std::string_view ns = ".") const override;
     std::pmr::string childEdgeType(std::string_view ns = ".") const override;
@@ -266,10 +280,16 @@ public:
     std::pmr::string generatePolymorphicGraph_h() const override;
     std::pmr::string generateMemberFunctions_h() const override;
     std::pmr::string generateReserve_h() const override;
+    std::pmr::string generateFrozenGraph_h() const override;
+    std::pmr::string generateSlotMap_h() const override;
+    std::pmr::string generateReset_h() const override;
+    std::pmr::string generateFragment_h() const override;
     std::pmr::string generateTags_h() const override;
     std::pmr::string generateMembers_h() const override;
 
     std::pmr::string generateReserve_cpp() const override;
+    std::pmr::string generateFrozenGraph_cpp() const override;
+    std::pmr::string generateReset_cpp() const override;
 
     std::pmr::string generateAddEdge(bool property,
         bool cntr, bool variadic, bool reference, bool function = true) const override;
@@ -290,6 +310,12 @@ public:
         bool bDLL, std::string_view projectName, const allocator_type& alloc);
 
     void prepareNamespace(std::string_view& ns) const;
+    std::pmr::vector<std::pmr::string> getCapacityMembers() const;
+    std::string_view getCapacityFieldName(std::string_view member) const noexcept;
+    bool hasCapacityTotals() const noexcept;
+    std::pmr::vector<std::pmr::string> getFrozenStringMaps() const;
+    bool canReset() const;
+    bool canRebind() const;
 
     CppStructBuilder mStruct;
     const Graph* mGraph = nullptr;
@@ -472,6 +498,16 @@ struct ModuleBuilder {
         std::string_view componentName, std::string_view componentMemberName = "");
 
     void outputModule(std::string_view name, std::pmr::set<std::pmr::string>& files) const;
+    // returns the modules skipped because their fingerprints are unchanged
+    std::pmr::vector<std::string_view> outputModules(std::span<const std::string_view> names,
+        std::pmr::set<std::pmr::string>& files, uint32_t numThreads) const;
+    void outputModuleFeatures(ModuleGraph::vertex_descriptor moduleID, Features outputs,
+        std::pmr::set<std::pmr::string>& files, std::pmr::memory_resource* scratch) const;
+    void collectModuleFiles(ModuleGraph::vertex_descriptor moduleID, Features outputs,
+        std::pmr::set<std::pmr::string>& files) const;
+    // every file written for the features, c++ and typescript
+    std::pmr::vector<std::filesystem::path> getModuleOutputs(ModuleGraph::vertex_descriptor moduleID,
+        Features outputs, std::pmr::memory_resource* scratch) const;
 
     void projectTypescript(std::string_view cpp, std::string_view ts);
     void addTypescriptFunctions(SyntaxGraph::vertex_descriptor vertID, std::string_view content);
@@ -494,6 +530,7 @@ struct ModuleBuilder {
 
     std::filesystem::path mCppFolder;
     std::filesystem::path mTypescriptFolder;
+    std::filesystem::path mFingerprintFile;
     SyntaxGraph mSyntaxGraph;
     ModuleGraph mModuleGraph;
     std::pmr::string mCurrentModule;
@@ -4,15 +4,13 @@ namespace Cocos::Meta {
 
 void outputComment(std::ostream& oss, std::pmr::string& space, std::string_view comment) {
     OSS << "/**\n";
-    std::istringstream iss{ std::string{ comment } };
-    std::string line;
-    while (std::getline(iss, line)) {
+    forEachLine(comment, [&](std::string_view line) {
         if (line.empty()) {
             OSS << " *\n";
-            continue;
+            return;
         }
         OSS << " * " << line << "\n";
-    }
+    });
     OSS << " */\n";
 }
 
@@ -38,15 +36,13 @@ void outputMethodComment(std::ostream& oss, std::pmr::string& space,
     if (any(method.mFlags & Doc::Deprecated)) {
         OSS << " * @deprecated Method will be removed in 3.9.0\n";
     }
-    std::istringstream iss{ std::string{ method.mComment } };
-    std::string line;
-    while (std::getline(iss, line)) {
+    forEachLine(method.mComment, [&](std::string_view line) {
         if (line.empty()) {
             OSS << " *\n";
-            continue;
+            return;
         }
         OSS << " * " << line << "\n";
-    }
+    });
     OSS << " */\n";
 }
 
@@ -93,7 +93,7 @@ std::pmr::string generateFwd_h(std::string_view projectName,
     std::string_view moduleName0,
     std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) {
     const auto moduleID = locate(moduleName0, mg);
-    pmr_ostringstream oss(std::ios_base::out, mr);
+    CodeStream oss(mr);
     std::pmr::string space(scratch);
     CodegenContext context(scratch);
 
@@ -161,11 +161,7 @@ std::pmr::string generateFwd_h(std::string_view projectName,
         oss << "#include \"cocos/base/std/hash/hash.h\"\n";
     }
 
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& moduleName = get(g.modulePaths, g, vertID);
-        if (moduleName != moduleName0) {
-            continue;
-        }
+    for (const auto& vertID : g.getModuleVertices(moduleName0)) {
         if (!holds_tag<Define_>(vertID, g)) {
             continue;
         }
@@ -175,11 +171,7 @@ std::pmr::string generateFwd_h(std::string_view projectName,
         OSS << "#define " << name << " " << def.mContent << "\n";
     }
 
-    for (int i = 0; const auto& vertID : make_range(vertices(g))) {
-        const auto& moduleName = get(g.modulePaths, g, vertID);
-        if (moduleName != moduleName0) {
-            continue;
-        }
+    for (int i = 0; const auto& vertID : g.getModuleVertices(moduleName0)) {
         if (!holds_tag<Concept_>(vertID, g)) {
             continue;
         }
@@ -212,12 +204,7 @@ std::pmr::string generateFwd_h(std::string_view projectName,
         std::pmr::vector<SyntaxGraph::vertex_descriptor>>
         constrains(scratch);
 
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& moduleName = get(g.modulePaths, g, vertID);
-        if (moduleName != moduleName0) {
-            continue;
-        }
-
+    for (const auto& vertID : g.getModuleVertices(moduleName0)) {
         if (holds_tag<Define_>(vertID, g)) {
             continue;
         }
@@ -245,7 +232,7 @@ std::pmr::string generateFwd_h(std::string_view projectName,
         CppStructBuilder cpp(&g, &mg, vertID, moduleID, ns, projectName, scratch);
 
         auto outputConstraints = [&]() {
-            pmr_ostringstream oss(std::ios_base::out, mr);
+            CodeStream oss(mr);
             std::pmr::string space(scratch);
             if (!constraints.mConcepts.empty()) {
                 for (const auto& conceptPath : constraints.mConcepts) {
@@ -284,7 +271,7 @@ std::pmr::string generateFwd_h(std::string_view projectName,
                     }
                 }
             }
-            return oss.str();
+            return oss.release();
         };
 
         std::pmr::string constraintsContent(scratch);
@@ -384,12 +371,7 @@ std::pmr::string generateFwd_h(std::string_view projectName,
         oss << "\n";
         OSS << "namespace ccstd {\n";
 
-        for (const auto& vertID : make_range(vertices(g))) {
-            const auto& moduleName = get(g.modulePaths, g, vertID);
-            if (moduleName != moduleName0) {
-                continue;
-            }
-
+        for (const auto& vertID : g.getModuleVertices(moduleName0)) {
             const auto& traits = get(g.traits, g, vertID);
             if (traits.mFlags & GenerationFlags::HASH_COMBINE) {
                 auto name = getCppPath(g.getDependentName("/std", vertID, scratch, scratch), scratch);
@@ -407,24 +389,19 @@ std::pmr::string generateFwd_h(std::string_view projectName,
         OSS << "} // namespace ccstd\n";
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string generateNames_h(const SyntaxGraph& g,
     const ModuleGraph& mg,
     std::string_view moduleName0,
     std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios_base::out, mr);
+    CodeStream oss(mr);
     std::pmr::string space(scratch);
     CodegenContext context(scratch);
 
     int count = 0;
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& moduleName = get(g.modulePaths, g, vertID);
-        if (moduleName != moduleName0) {
-            continue;
-        }
-
+    for (const auto& vertID : g.getModuleVertices(moduleName0)) {
         if (holds_tag<Define_>(vertID, g)) {
             continue;
         }
@@ -498,7 +475,7 @@ std::pmr::string generateNames_h(const SyntaxGraph& g,
     }
     outputNamespaces(oss, space, context, "");
 
-    return oss.str();
+    return oss.release();
 }
 
 namespace {
@@ -509,7 +486,7 @@ void collectBases(const SyntaxGraph& g,
     std::pmr::map<SyntaxGraph::vertex_descriptor, SyntaxGraph::vertex_descriptor>& baseIDs,
     std::pmr::vector<SyntaxGraph::vertex_descriptor>& results) {
     for (const auto& base : bases) {
-        auto baseID = locate(base.mTypePath, g);
+        auto baseID = locate(base, g);
         // populate all bases
         auto& childBases = get(g.inherits, g, baseID).mBases;
         collectBases(g, baseID, childBases, baseIDs, results);
@@ -671,7 +648,7 @@ struct VisitorTypes_h : boost::dfs_visitor<> {
             }
 
             const auto& baseTraits = get(g.traits, g, baseID);
-            const auto name = g.getDependentCppName(ns, implID, scratch, scratch);
+            const auto name = g.getCachedDependentCppName(ns, implID, scratch);
             visit_vertex(
                 baseID, g,
                 [&](const Composition_ auto& s) {
@@ -1015,6 +992,10 @@ struct VisitorTypes_h : boost::dfs_visitor<> {
                 copyString(oss, space, builder.generatePolymorphicGraph_h());
                 copyString(oss, space, builder.generateMemberFunctions_h());
                 copyString(oss, space, builder.generateReserve_h());
+                copyString(oss, space, builder.generateFrozenGraph_h());
+                copyString(oss, space, builder.generateSlotMap_h());
+                copyString(oss, space, builder.generateReset_h());
+                copyString(oss, space, builder.generateFragment_h());
                 oss << "\n";
                 OSS << "// Members";
             },
@@ -1250,6 +1231,8 @@ struct VisitorTypes_cpp : boost::dfs_visitor<> {
                 const auto& cpp = builder.mStruct;
                 copyString(oss, space, cpp.generateCppConstructors());
                 copyString(oss, space, builder.generateReserve_cpp());
+                copyString(oss, space, builder.generateFrozenGraph_cpp());
+                copyString(oss, space, builder.generateReset_cpp());
             },
             [&](const auto&) {
             });
@@ -1272,7 +1255,7 @@ std::pmr::string generateTypes_h(std::string_view projectName,
     const ModuleGraph& mg,
     std::string_view moduleName0,
     std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios_base::out, mr);
+    CodeStream oss(mr);
     std::pmr::string space(scratch);
 
     const auto moduleID = locate(moduleName0, mg);
@@ -1292,21 +1275,22 @@ std::pmr::string generateTypes_h(std::string_view projectName,
         mg, moduleID, bDLL, apiDLL, projectName, context
     };
 
-    auto colors = g.colors(scratch);
+    auto colors = g.packedColors(scratch);
+    const auto colorMap = get(colors, g);
     for (int count = 0; const auto& vertID : make_range(vertices(g))) {
-        if (colors[vertID] != boost::default_color_type::white_color) {
+        if (get(colorMap, vertID) != boost::two_bit_white) {
             continue;
         }
         if (!visitor.needOutput(vertID, g)) {
             continue;
         }
         if (!g.isComposition(vertID)) {
-            colors[vertID] = boost::default_color_type::black_color;
+            put(colorMap, vertID, boost::two_bit_black);
             visitor.discover_vertex(vertID, g1);
             visitor.finish_vertex(vertID, g1);
             continue;
         }
-        boost::depth_first_visit(g1, vertID, visitor, get(colors, g));
+        boost::depth_first_visit(g1, vertID, visitor, colorMap);
     }
     outputNamespaces(oss, space, context, "");
 
@@ -1314,12 +1298,7 @@ std::pmr::string generateTypes_h(std::string_view projectName,
         oss << "\n";
         OSS << "namespace ccstd {\n";
 
-        for (const auto& vertID : make_range(vertices(g))) {
-            const auto& moduleName = get(g.modulePaths, g, vertID);
-            if (moduleName != moduleName0) {
-                continue;
-            }
-
+        for (const auto& vertID : g.getModuleVertices(moduleName0)) {
             const auto& traits = get(g.traits, g, vertID);
             visit_vertex(
                 vertID, g,
@@ -1335,7 +1314,7 @@ std::pmr::string generateTypes_h(std::string_view projectName,
                                 if (m.mFlags & NOT_ELEMENT) {
                                     continue;
                                 }
-                                const auto memberID = locate(m.mTypePath, g);
+                                const auto memberID = locate(m, g);
                                 if (g.isIntrusivePtr(memberID)) {
                                     continue;
                                 }
@@ -1353,7 +1332,7 @@ std::pmr::string generateTypes_h(std::string_view projectName,
         OSS << "} // namespace ccstd\n";
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string generateTypes_cpp(std::string_view projectName,
@@ -1368,12 +1347,13 @@ std::pmr::string generateTypes_cpp(std::string_view projectName,
         return std::pmr::string(mr);
     }
 
-    pmr_ostringstream oss(std::ios_base::out, mr);
+    CodeStream oss(mr);
     std::pmr::string space(scratch);
 
     CodegenContext context(scratch);
 
-    auto colors = g.colors(scratch);
+    auto colors = g.packedColors(scratch);
+    const auto colorMap = get(colors, g);
     Impl::AddressableView<SyntaxGraph> g1(const_cast<SyntaxGraph&>(g));
     VisitorTypes_cpp visitor{
         {}, oss, space, moduleName0, scratch,
@@ -1381,7 +1361,7 @@ std::pmr::string generateTypes_cpp(std::string_view projectName,
     };
 
     for (const auto& vertID : make_range(vertices(g))) {
-        if (colors[vertID] != boost::default_color_type::white_color) {
+        if (get(colorMap, vertID) != boost::two_bit_white) {
             continue;
         }
 
@@ -1393,12 +1373,12 @@ std::pmr::string generateTypes_cpp(std::string_view projectName,
         if (!g.hasImpl(vertID, bDLL))
             continue;
 
-        boost::depth_first_visit(g1, vertID, visitor, get(colors, g));
+        boost::depth_first_visit(g1, vertID, visitor, colorMap);
     }
 
     outputNamespaces(oss, space, context, "");
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string generateGraphs_h(std::string_view projectName,
@@ -1410,16 +1390,12 @@ std::pmr::string generateGraphs_h(std::string_view projectName,
     const auto& moduleInfo = get(mg.modules, mg, moduleID);
     const bool bDLL = !moduleInfo.mAPI.empty();
 
-    pmr_ostringstream oss(std::ios_base::out, mr);
+    CodeStream oss(mr);
     std::pmr::string space(scratch);
 
     CodegenContext context(scratch);
 
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& moduleName = get(g.modulePaths, g, vertID);
-        if (moduleName != moduleName0) {
-            continue;
-        }
+    for (const auto& vertID : g.getModuleVertices(moduleName0)) {
         if (!holds_tag<Graph_>(vertID, g))
             continue;
 
@@ -1455,11 +1431,7 @@ std::pmr::string generateGraphs_h(std::string_view projectName,
         std::string_view ns = "/boost";
         auto bNewNamespace = outputNamespaces(oss, space, context, ns);
 
-        for (const auto& vertID : make_range(vertices(g))) {
-            const auto& moduleName = get(g.modulePaths, g, vertID);
-            if (moduleName != moduleName0) {
-                continue;
-            }
+        for (const auto& vertID : g.getModuleVertices(moduleName0)) {
             if (!holds_tag<Graph_>(vertID, g))
                 continue;
 
@@ -1480,11 +1452,7 @@ std::pmr::string generateGraphs_h(std::string_view projectName,
         outputNamespaces(oss, space, context, "");
     }
 
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& moduleName = get(g.modulePaths, g, vertID);
-        if (moduleName != moduleName0) {
-            continue;
-        }
+    for (const auto& vertID : g.getModuleVertices(moduleName0)) {
         if (!holds_tag<Graph_>(vertID, g))
             continue;
 
@@ -1508,7 +1476,7 @@ std::pmr::string generateGraphs_h(std::string_view projectName,
     }
     outputNamespaces(oss, space, context, "");
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string generateReflection_h(std::string_view projectName,
@@ -1516,7 +1484,7 @@ std::pmr::string generateReflection_h(std::string_view projectName,
     const ModuleGraph& mg,
     std::string_view moduleName0,
     std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios_base::out, mr);
+    CodeStream oss(mr);
     std::pmr::string space(scratch);
     CodegenContext context(scratch);
 
@@ -1527,12 +1495,7 @@ std::pmr::string generateReflection_h(std::string_view projectName,
     apiDLL.append("_API");
 
     int count = 0;
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& moduleName = get(g.modulePaths, g, vertID);
-        if (moduleName != moduleName0) {
-            continue;
-        }
-
+    for (const auto& vertID : g.getModuleVertices(moduleName0)) {
         if (holds_tag<Define_>(vertID, g)) {
             continue;
         }
@@ -1619,7 +1582,7 @@ std::pmr::string generateReflection_h(std::string_view projectName,
     }
     outputNamespaces(oss, space, context, "");
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string generateReflection_cpp(std::string_view projectName,
@@ -1627,7 +1590,7 @@ std::pmr::string generateReflection_cpp(std::string_view projectName,
     const ModuleGraph& mg,
     std::string_view moduleName0,
     std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios_base::out, mr);
+    CodeStream oss(mr);
     std::pmr::string space(scratch);
     CodegenContext context(scratch);
 
@@ -1638,12 +1601,7 @@ std::pmr::string generateReflection_cpp(std::string_view projectName,
     apiDLL.append("_API");
 
     int count = 0;
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& moduleName = get(g.modulePaths, g, vertID);
-        if (moduleName != moduleName0) {
-            continue;
-        }
-
+    for (const auto& vertID : g.getModuleVertices(moduleName0)) {
         if (holds_tag<Define_>(vertID, g)) {
             continue;
         }
@@ -1794,7 +1752,7 @@ std::pmr::string generateReflection_cpp(std::string_view projectName,
     }
     outputNamespaces(oss, space, context, "");
 
-    return oss.str();
+    return oss.release();
 }
 
 }
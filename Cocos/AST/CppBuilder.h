@@ -58,6 +58,9 @@ std::pmr::string generateGraphs_h(std::string_view projectName,
     std::string_view moduleName,
     std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch);
 
+// helpers used by the generated graphs, written once for all modules
+std::pmr::string generateGraphSupport_h(std::pmr::memory_resource* scratch);
+
 std::pmr::string generateReflection_h(std::string_view projectName,
     const SyntaxGraph& g,
     const ModuleGraph& mg,
@@ -31,6 +31,7 @@ THE SOFTWARE.
 namespace Cocos::Meta {
 
 void addCppDefaultValues(ModuleBuilder& builder) {
+    PROFILE_SCOPE(__func__);
     // Value
     VALUE(void);
 
@@ -165,6 +166,7 @@ void addCppDefaultValues(ModuleBuilder& builder) {
 
         IMPORT_PMR_CLASS(PmrString, .mFlags = JSB);
         PMR_CONTAINER(PmrList);
+        PMR_CONTAINER(PmrEdgePool);
 
         MAP(Record);
 
@@ -184,6 +186,7 @@ void addCppDefaultValues(ModuleBuilder& builder) {
         PMR_MAP(PmrUnorderedMultiMap);
         PMR_MAP(PmrUnorderedStringMap);
         PMR_MAP(PmrUnorderedStringMultiMap);
+        PMR_MAP(PmrFrozenStringMap);
 
         CONTAINER(TransparentSet);
         CONTAINER(TransparentMultiSet);
@@ -124,14 +124,14 @@ std::pmr::string CppGraphBuilder::vertexDesc(std::string_view ns) const {
 
 std::pmr::string CppGraphBuilder::edgeDesc(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::vertexType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     auto scratch = get_allocator().resource();
     auto name = getCppPath(g.getDependentName(
@@ -141,12 +141,12 @@ std::pmr::string CppGraphBuilder::vertexType(std::string_view ns) const {
     } else {
         oss << name << "::Vertex";
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::edgeType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
@@ -160,12 +160,12 @@ std::pmr::string CppGraphBuilder::edgeType(std::string_view ns) const {
     } else {
         oss << "impl::ListEdge<vertex_descriptor>";
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::vertexPropertyType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
@@ -187,29 +187,29 @@ std::pmr::string CppGraphBuilder::edgePropertyType(std::string_view ns) const {
 
 std::pmr::string CppGraphBuilder::objectListType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
     auto vecID = locate(s.mVertexListPath, g);
     oss << getCppPath(g.getDependentName(ns, vecID, scratch, scratch), scratch) << "<Object>";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::vertexListType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
     auto vecID = locate(s.mVertexListPath, g);
     oss << getCppPath(g.getDependentName(ns, vecID, scratch, scratch), scratch) << "<Vertex>";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::edgeListType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
@@ -227,11 +227,11 @@ std::pmr::string CppGraphBuilder::edgeListType(std::string_view ns) const {
     }
     oss << name;
     oss << ">";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::componentContainerType() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     const auto& g = *mStruct.mSyntaxGraph;
     auto bPmr = g.isPmr(mStruct.mCurrentVertex);
@@ -248,25 +248,30 @@ std::pmr::string CppGraphBuilder::componentContainerType() const {
             oss << "/boost/container/list";
         }
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::outEdgeListType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
 
+    if (s.hasSmallEdgeList()) {
+        oss << "OutEdgeList";
+        return oss.release();
+    }
+
     auto listID = locate(s.mOutEdgeListPath, g);
     oss << getCppPath(g.getDependentName(ns, listID, scratch, scratch), scratch);
     oss << "<OutEdge>";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::outEdgeType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto name = graphType(ns);
@@ -306,11 +311,11 @@ std::pmr::string CppGraphBuilder::outEdgeType(std::string_view ns) const {
         }
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::outIterType() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     if (s.hasEdgeProperty() || s.mUndirected) {
         oss << "impl::OutPropertyEdgeIter<\n";
@@ -320,20 +325,76 @@ std::pmr::string CppGraphBuilder::outIterType() const {
     oss << "    " << outEdgeListType() << "::iterator,\n";
     oss << "    vertex_descriptor, edge_descriptor, "
         << s.mDifferenceType << ">";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::inEdgeListType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
 
+    if (s.hasSmallEdgeList()) {
+        oss << "InEdgeList";
+        return oss.release();
+    }
+
     auto listID = locate(s.mOutEdgeListPath, g);
     oss << getCppPath(g.getDependentName(ns, listID, scratch, scratch), scratch);
     oss << "<InEdge>";
-    return oss.str();
+    return oss.release();
+}
+
+std::pmr::string CppGraphBuilder::smallEdgeListType(std::string_view edgeType) const {
+    CodeStream oss(get_allocator());
+    const auto& g = *mStruct.mSyntaxGraph;
+    const auto& s = *mGraph;
+
+    if (g.isPmr(mStruct.mCurrentVertex)) {
+        oss << "boost::container::pmr::small_vector<";
+    } else {
+        oss << "boost::container::small_vector<";
+    }
+    oss << edgeType << ", " << s.getSmallEdgeListCapacity() << ">";
+    return oss.release();
+}
+
+std::pmr::string CppGraphBuilder::slotListType(std::string_view elemType, std::string_view ns) const {
+    prepareNamespace(ns);
+    CodeStream oss(get_allocator());
+    const auto& g = *mStruct.mSyntaxGraph;
+    const auto& s = *mGraph;
+    auto scratch = get_allocator().resource();
+
+    auto listID = locate(s.mVertexListPath, g);
+    oss << getCppPath(g.getDependentName(ns, listID, scratch, scratch), scratch);
+    oss << "<" << elemType << ">";
+    return oss.release();
+}
+
+std::pmr::string CppGraphBuilder::pathIndexType(std::string_view vertexDescriptor) const {
+    CodeStream oss(get_allocator());
+    const auto& g = *mStruct.mSyntaxGraph;
+    const auto& s = *mGraph;
+
+    if (g.isPmr(mStruct.mCurrentVertex)) {
+        oss << "PmrTransparentMap<";
+        if (s.mAddressableConcept.mUtf8) {
+            oss << "ccstd::pmr::u8string";
+        } else {
+            oss << "ccstd::pmr::string";
+        }
+    } else {
+        oss << "TransparentMap<";
+        if (s.mAddressableConcept.mUtf8) {
+            oss << "ccstd::u8string";
+        } else {
+            oss << "ccstd::string";
+        }
+    }
+    oss << ", " << vertexDescriptor << ">";
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::inEdgeType(std::string_view ns) const {
@@ -342,7 +403,7 @@ std::pmr::string CppGraphBuilder::inEdgeType(std::string_view ns) const {
 }
 
 std::pmr::string CppGraphBuilder::inIterType() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
 
     if (s.hasEdgeProperty() || s.mUndirected) {
@@ -354,22 +415,40 @@ std::pmr::string CppGraphBuilder::inIterType() const {
     oss << "    vertex_descriptor, edge_descriptor, "
         << s.mDifferenceType << ">";
 
-    return oss.str();
+    return oss.release();
+}
+
+std::pmr::string CppGraphBuilder::frozenOffsetListType(std::string_view ns) const {
+    prepareNamespace(ns);
+    CodeStream oss(get_allocator());
+    const auto& g = *mStruct.mSyntaxGraph;
+    const auto& s = *mGraph;
+    auto scratch = get_allocator().resource();
+
+    auto listID = locate(s.mOutEdgeListPath, g);
+    oss << getCppPath(g.getDependentName(ns, listID, scratch, scratch), scratch);
+    oss << "<" << s.mEdgeSizeType << ">";
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::edgeIterType() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::childListType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
 
+    if (s.mAliasGraph && s.hasSmallEdgeList()) {
+        oss << "OutEdgeList";
+        return oss.release();
+    }
+
     auto listID = locate(s.mOutEdgeListPath, g);
     oss << getCppPath(g.getDependentName(ns, listID, scratch, scratch), scratch);
     if (s.mAliasGraph) {
@@ -377,51 +456,56 @@ std::pmr::string CppGraphBuilder::childListType(std::string_view ns) const {
     } else {
         oss << "<ChildEdge>";
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::childEdgeType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     if (s.mAliasGraph) {
         oss << "OutEdge";
     } else {
         oss << "impl::StoredEdge<vertex_descriptor>";
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::childIterType() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
 
     oss << "impl::OutEdgeIter<\n";
     oss << "    " << childListType() << "::iterator,\n";
     oss << "    vertex_descriptor, ownership_descriptor, " << s.mDifferenceType << ">";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::parentEdgeType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     if (s.mAliasGraph) {
         oss << "InEdge";
     } else {
         oss << "impl::StoredEdge<vertex_descriptor>";
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::parentListType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
 
+    if (s.mAliasGraph && s.hasSmallEdgeList()) {
+        oss << "InEdgeList";
+        return oss.release();
+    }
+
     auto listID = locate(s.mOutEdgeListPath, g);
     oss << getCppPath(g.getDependentName(ns, listID, scratch, scratch), scratch);
     if (s.mAliasGraph) {
@@ -429,11 +513,11 @@ std::pmr::string CppGraphBuilder::parentListType(std::string_view ns) const {
     } else {
         oss << "<ParentEdge>";
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::parentIterType() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
@@ -442,11 +526,11 @@ std::pmr::string CppGraphBuilder::parentIterType() const {
     oss << "    " << parentListType() << "::iterator,\n";
     oss << "    vertex_descriptor, ownership_descriptor, " << s.mDifferenceType << ">";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::referenceIterType() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
 
     if (s.mAliasGraph) {
@@ -456,34 +540,36 @@ std::pmr::string CppGraphBuilder::referenceIterType() const {
         oss << "impl::OwnershipIterator<vertex_iterator, children_iterator, "
             << graphType(mStruct.mCurrentNamespace) << ">";
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::vertexIterType() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
-    if (s.isVector()) {
+    if (s.isSlotMap()) {
+        oss << "boost::filter_iterator<SlotFilter, boost::counting_iterator<vertex_descriptor>>";
+    } else if (s.isVector()) {
         oss << "boost::integer_range<vertex_descriptor>::iterator";
     } else {
         oss << "impl::VertexIter<" << vertexListType()
             << "::iterator, vertex_descriptor, "
             << s.mDifferenceType << ">";
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::adjIterType() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     std::pmr::string space(get_allocator());
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::tagType(std::string_view ns) const {
     const auto& cpp = mStruct;
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
@@ -501,12 +587,12 @@ std::pmr::string CppGraphBuilder::tagType(std::string_view ns) const {
         oss << cpp.getDependentName(conceptID);
     }
     oss << ">";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::valueType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
@@ -520,17 +606,17 @@ std::pmr::string CppGraphBuilder::valueType(std::string_view ns) const {
     for (const auto& c : s.mPolymorphic.mConcepts) {
         if (count++)
             oss << ", ";
-        auto conceptID = locate(c.mValue, g);
+        auto conceptID = locate(c, g);
         oss << getCppPath(g.getDependentName(ns, conceptID, scratch, scratch), scratch);
         oss << "*";
     }
     oss << ">";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::constValueType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
@@ -545,25 +631,25 @@ std::pmr::string CppGraphBuilder::constValueType(std::string_view ns) const {
         if (count++)
             oss << ", ";
         oss << "const ";
-        auto conceptID = locate(c.mValue, g);
+        auto conceptID = locate(c, g);
         oss << getCppPath(g.getDependentName(ns, conceptID, scratch, scratch), scratch);
         oss << "*";
     }
     oss << ">";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::handleElemType(const PolymorphicPair& pair,
     std::string_view ns, bool bSkipName) const {
     const auto& cpp = mStruct;
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
 
     auto tagID = locate(pair.mTag, g);
-    auto valueID = locate(pair.mValue, g);
+    auto valueID = locate(pair, g);
     
     auto tagName = cpp.getDependentName(tagID);
     auto valueName = getCppPath(g.getDependentName(ns, valueID, scratch, scratch), scratch);
@@ -586,12 +672,12 @@ std::pmr::string CppGraphBuilder::handleElemType(const PolymorphicPair& pair,
         }
     }
     oss << ">";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::handleType(std::string_view ns) const {
     prepareNamespace(ns);
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
@@ -608,16 +694,16 @@ std::pmr::string CppGraphBuilder::handleType(std::string_view ns) const {
             if (count++) {
                 oss << ",\n";
             }
-            auto conceptID = locate(c.mValue, g);
+            auto conceptID = locate(c, g);
             oss << handleElemType(c, ns);
         }
     }
     oss << ">\n";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::vertexPropertyMapName(bool bConst) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     const auto& cpp = mStruct;
@@ -664,11 +750,11 @@ std::pmr::string CppGraphBuilder::vertexPropertyMapName(bool bConst) const {
     }
     oss << ">";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::vertexPropertyMapMemberName(bool bConst) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     const auto& cpp = mStruct;
@@ -731,11 +817,11 @@ std::pmr::string CppGraphBuilder::vertexPropertyMapMemberName(bool bConst) const
     }
     oss << ">";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::edgePropertyMapName(bool bConst) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     const auto& cpp = mStruct;
@@ -772,11 +858,11 @@ std::pmr::string CppGraphBuilder::edgePropertyMapName(bool bConst) const {
     }
     oss << ">";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::edgePropertyMapMemberName(bool bConst, std::string_view stringPath) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     const auto& cpp = mStruct;
@@ -834,11 +920,11 @@ std::pmr::string CppGraphBuilder::edgePropertyMapMemberName(bool bConst, std::st
     }
     oss << ">";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::vertexComponentMapName(const Component& c, bool bConst) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     const auto& cpp = mStruct;
@@ -918,12 +1004,12 @@ std::pmr::string CppGraphBuilder::vertexComponentMapName(const Component& c, boo
         OSS << (bConst ? "const " : "") << component << "&";
     }
     oss << ">";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::vertexComponentMapMemberName(
     const Component& c, bool bConst, std::string_view stringPath) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     const auto& cpp = mStruct;
@@ -1024,20 +1110,20 @@ std::pmr::string CppGraphBuilder::vertexComponentMapMemberName(
     }
     oss << ">";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateVertexType(std::string_view name, bool layer) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
     auto scratch = get_allocator().resource();
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateAllocator_h() {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& cpp = mStruct;
@@ -1064,11 +1150,11 @@ inline boost::container::pmr::memory_resource* resource() const noexcept {
 })");
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateConstructors_h() {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& cpp = mStruct;
@@ -1080,11 +1166,11 @@ std::pmr::string CppGraphBuilder::generateConstructors_h() {
     if (!cntrs.empty())
         ++mCount;
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateGraph_h() {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& cpp = mStruct;
@@ -1184,14 +1270,14 @@ std::pmr::string CppGraphBuilder::generateGraph_h() {
         OSS << "using edge_type = " << edgeType() << ";\n";
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateIncidenceGraph_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     if (!s.mIncidence)
-        return oss.str();
+        return oss.release();
 
     std::pmr::string space(get_allocator());
 
@@ -1207,16 +1293,19 @@ std::pmr::string CppGraphBuilder::generateIncidenceGraph_h() const {
         copyString(oss, space, content, true);
         oss << ";\n";
     }
+    if (s.hasSmallEdgeList()) {
+        OSS << "using OutEdgeList = " << smallEdgeListType("OutEdge") << ";\n";
+    }
     OSS << "using out_edge_iterator = " << outIterType() << ";\n";
     OSS << "using degree_size_type = " << s.mDegreeSizeType << ";\n";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateBidirectionalGraph_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     if (!s.mIncidence || !s.mBidirectional)
-        return oss.str();
+        return oss.release();
 
     std::pmr::string space(get_allocator());
     oss << "\n";
@@ -1231,16 +1320,19 @@ std::pmr::string CppGraphBuilder::generateBidirectionalGraph_h() const {
         copyString(oss, space, content, true);
         oss << ";\n";
     }
+    if (s.hasSmallEdgeList()) {
+        OSS << "using InEdgeList = " << smallEdgeListType("InEdge") << ";\n";
+    }
     OSS << "using in_edge_iterator = " << inIterType() << ";\n";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateAdjacencyGraph_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     if (!s.mAdjacency)
-        return oss.str();
+        return oss.release();
 
     std::pmr::string space(get_allocator());
     oss << "\n";
@@ -1248,18 +1340,26 @@ std::pmr::string CppGraphBuilder::generateAdjacencyGraph_h() const {
     OSS << "using adjacency_iterator = boost::adjacency_iterator_generator<\n";
     OSS << "    " << graphType(mStruct.mCurrentNamespace) << ", vertex_descriptor, out_edge_iterator>::type;\n";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateVertexListGraph_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     if (!s.mVertexList)
-        return oss.str();
+        return oss.release();
 
     std::pmr::string space(get_allocator());
     oss << "\n";
     OSS << "// VertexListGraph\n";
+    if (s.isSlotMap()) {
+        OSS << "struct SlotFilter {\n";
+        OSS << "    bool operator()(vertex_descriptor v) const noexcept {\n";
+        OSS << "        return ((*generations)[v] & 1) == 0;\n";
+        OSS << "    }\n";
+        OSS << "    const " << slotListType("uint32_t") << "* generations = nullptr;\n";
+        OSS << "};\n";
+    }
     OSS << "using vertex_iterator    = " << vertexIterType() << ";\n";
     OSS << "using vertices_size_type = " << s.mVertexSizeType << ";\n";
     if (s.hasVertexProperty()) {
@@ -1273,6 +1373,9 @@ std::pmr::string CppGraphBuilder::generateVertexListGraph_h() const {
         if (s.isVector()) {
             if (s.mIncidence) {
                 OSS << "inline " << outEdgeListType() << "& getOutEdgeList(vertex_descriptor v) noexcept {\n";
+                if (s.mCsrFreeze) {
+                    OSS << "    CC_EXPECTS(!frozen());\n";
+                }
                 OSS << "    return _vertices[v].outEdges;\n";
                 OSS << "}\n";
                 OSS << "inline const " << outEdgeListType() << "& getOutEdgeList(vertex_descriptor v) const noexcept {\n";
@@ -1282,6 +1385,9 @@ std::pmr::string CppGraphBuilder::generateVertexListGraph_h() const {
                 if (s.mBidirectional) {
                     oss << "\n";
                     OSS << "inline " << inEdgeListType() << "& getInEdgeList(vertex_descriptor v) noexcept {\n";
+                    if (s.mCsrFreeze) {
+                        OSS << "    CC_EXPECTS(!frozen());\n";
+                    }
                     OSS << "    return _vertices[v].inEdges;\n";
                     OSS << "}\n";
                     OSS << "inline const " << inEdgeListType() << "& getInEdgeList(vertex_descriptor v) const noexcept {\n";
@@ -1290,28 +1396,76 @@ std::pmr::string CppGraphBuilder::generateVertexListGraph_h() const {
                 }
                 oss << "\n";
             }
-            OSS << "inline boost::integer_range<vertex_descriptor> getVertexList() const noexcept {\n";
+            if (s.isSlotMap()) {
+                // free slots are skipped, they have no edges
+                OSS << "inline boost::iterator_range<vertex_iterator> getVertexList() const noexcept {\n";
+                {
+                    INDENT();
+                    OSS << "const SlotFilter filter{&_generations};\n";
+                    OSS << "const boost::counting_iterator<vertex_descriptor> first(0);\n";
+                    OSS << "const boost::counting_iterator<vertex_descriptor> last(\n";
+                    OSS << "    static_cast<vertex_descriptor>(_vertices.size()));\n";
+                    OSS << "return {vertex_iterator(filter, first, last), vertex_iterator(filter, last, last)};\n";
+                }
+                OSS << "}\n";
+            } else {
+                OSS << "inline boost::integer_range<vertex_descriptor> getVertexList() const noexcept {\n";
 #ifdef CC_USE_GSL
-            OSS << "    return {0, gsl::narrow_cast<vertices_size_type>(_vertices.size())};\n";
+                OSS << "    return {0, gsl::narrow_cast<vertices_size_type>(_vertices.size())};\n";
 #else
-            OSS << "    return {0, static_cast<vertices_size_type>(_vertices.size())};\n";
+                OSS << "    return {0, static_cast<vertices_size_type>(_vertices.size())};\n";
 #endif
-            OSS << "}\n";
+                OSS << "}\n";
+            }
 
-            oss << "\n";
-            OSS << "inline vertex_descriptor getCurrentID() const noexcept {\n";
+            if (s.isSlotMap()) {
+                // the slot of a polymorphic graph depends on the value type, no current id
+                if (!s.isPolymorphic()) {
+                    oss << "\n";
+                    OSS << "inline vertex_descriptor getCurrentID() const noexcept {\n";
+                    OSS << "    return _freeSlots.empty()\n";
+                    OSS << "               ? static_cast<vertex_descriptor>(_vertices.size())\n";
+                    OSS << "               : _freeSlots.back();\n";
+                    OSS << "}\n";
+                }
+            } else {
+                oss << "\n";
+                OSS << "inline vertex_descriptor getCurrentID() const noexcept {\n";
 #ifdef CC_USE_GSL
-            OSS << "    return gsl::narrow_cast<vertex_descriptor>(_vertices.size());\n";
+                OSS << "    return gsl::narrow_cast<vertex_descriptor>(_vertices.size());\n";
 #else
-            OSS << "    return static_cast<vertex_descriptor>(_vertices.size());\n";
+                OSS << "    return static_cast<vertex_descriptor>(_vertices.size());\n";
 #endif
-            OSS << "}\n";
+                OSS << "}\n";
+            }
             if (s.mColorMap) {
                 oss << "\n";
                 OSS << "inline ccstd::pmr::vector<boost::default_color_type> colors(boost::container::pmr::memory_resource* mr) const {\n";
                 OSS << "    return ccstd::pmr::vector<boost::default_color_type>(_vertices.size(), mr);\n";
                 OSS << "}\n";
             }
+            if (s.hasPackedColorMap()) {
+                OSS << "inline impl::PackedColors packedColors(boost::container::pmr::memory_resource* mr) const {\n";
+                OSS << "    return impl::PackedColors(_vertices.size(), mr);\n";
+                OSS << "}\n";
+                OSS << "inline impl::VisitedBitset visitedBitset(boost::container::pmr::memory_resource* mr) const {\n";
+                OSS << "    return impl::VisitedBitset(_vertices.size(), mr);\n";
+                OSS << "}\n";
+            }
+            if (s.hasLevels()) {
+                oss << "\n";
+                OSS << "// Levels, vertices of the same level do not depend on each other,\n";
+                OSS << "// level i holds vertices[offsets[i], offsets[i + 1])\n";
+                OSS << "struct GraphLevels {\n";
+                {
+                    INDENT();
+                    OSS << "explicit GraphLevels(boost::container::pmr::memory_resource* mr) noexcept\n";
+                    OSS << "    : vertices(mr), offsets(mr) {}\n";
+                    OSS << "ccstd::pmr::vector<vertex_descriptor> vertices;\n";
+                    OSS << "ccstd::pmr::vector<vertices_size_type> offsets;\n";
+                }
+                OSS << "};\n";
+            }
         } else {
             if (s.mIncidence) {
                 OSS << "inline " << outEdgeListType() << "& getOutEdgeList(vertex_descriptor v) noexcept {\n";
@@ -1345,14 +1499,14 @@ std::pmr::string CppGraphBuilder::generateVertexListGraph_h() const {
         }
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateEdgeListGraph_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     if (!s.mEdgeList)
-        return oss.str();
+        return oss.release();
 
     std::pmr::string space(get_allocator());
 
@@ -1371,11 +1525,11 @@ std::pmr::string CppGraphBuilder::generateEdgeListGraph_h() const {
         oss << "\n";
         OSS << "using edge_property_type = " << edgePropertyType() << ";\n";
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateMutableGraph_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     std::pmr::string space(get_allocator());
     if (s.hasVertexProperty()) {
@@ -1424,16 +1578,16 @@ std::pmr::string CppGraphBuilder::generateMutableGraph_h() const {
         OSS << "}\n";
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateReferenceGraph_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     std::pmr::string space(get_allocator());
 
     if (!s.mReferenceGraph)
-        return oss.str();
+        return oss.release();
 
     oss << "\n";
     if (s.mAliasGraph) {
@@ -1545,31 +1699,31 @@ std::pmr::string CppGraphBuilder::generateReferenceGraph_h() const {
         }
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateParentGraph_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     std::pmr::string space(get_allocator());
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateAddressableGraph_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     std::pmr::string space(get_allocator());
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generatePolymorphicGraph_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     std::pmr::string space(get_allocator());
     if (!s.isPolymorphic())
-        return oss.str();
+        return oss.release();
 
     oss << "\n";
     OSS << "// PolymorphicGraph\n";
@@ -1582,11 +1736,11 @@ std::pmr::string CppGraphBuilder::generatePolymorphicGraph_h() const {
         copyString(oss, space, handleType(), true);
         oss << ";\n";
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateMemberFunctions_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     std::pmr::string api(get_allocator());
     api = mStruct.mAPI;
@@ -1602,11 +1756,11 @@ std::pmr::string CppGraphBuilder::generateMemberFunctions_h() const {
         copyCppString(oss, space, functions);
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateReserve_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
 
     auto hasReserve = [&]() {
@@ -1616,7 +1770,7 @@ std::pmr::string CppGraphBuilder::generateReserve_h() const {
     };
 
     if (!hasReserve())
-        return oss.str();
+        return oss.release();
 
     std::pmr::string space(get_allocator());
     oss << "\n";
@@ -1628,14 +1782,159 @@ std::pmr::string CppGraphBuilder::generateReserve_h() const {
     }
     oss << "void reserve(vertices_size_type sz);\n";
 
-    return oss.str();
+    std::pmr::string api(get_allocator());
+    if (!mStruct.mAPI.empty()) {
+        api = mStruct.mAPI;
+        api += "_API ";
+    }
+
+    oss << "\n";
+    OSS << "// CapacityStats, sizes of the lists kept at their high-water marks,\n";
+    OSS << "// so that the next build reserves them once\n";
+    OSS << "struct GraphCapacityStats {\n";
+    {
+        INDENT();
+        OSS << "uint32_t vertices = 0;\n";
+        for (const auto& member : getCapacityMembers()) {
+            OSS << "uint32_t " << getCapacityFieldName(member) << " = 0;\n";
+        }
+        if (hasCapacityTotals()) {
+            OSS << "// edges summed over all vertices, they size the frozen arrays\n";
+            OSS << "uint32_t outEdges = 0;\n";
+            if (s.mBidirectional) {
+                OSS << "uint32_t inEdges = 0;\n";
+            }
+        }
+    }
+    OSS << "};\n";
+    OSS << api << "void reserve(const GraphCapacityStats& stats);\n";
+    OSS << api << "void captureCapacity(GraphCapacityStats& stats) const noexcept;\n";
+
+    return oss.release();
+}
+
+std::pmr::string CppGraphBuilder::generateFrozenGraph_h() const {
+    CodeStream oss(get_allocator());
+    const auto& s = *mGraph;
+    const auto maps = getFrozenStringMaps();
+    if (!s.mCsrFreeze && maps.empty())
+        return oss.release();
+
+    std::pmr::string space(get_allocator());
+    oss << "\n";
+    OSS << "// FrozenGraph\n";
+    if (!maps.empty()) {
+        OSS << "// call freeze() once the graph is built, string maps also thaw on their own changes\n";
+    }
+    if (!mStruct.mAPI.empty()) {
+        OSS << mStruct.mAPI << "_API ";
+    } else {
+        OSS;
+    }
+    oss << "void freeze();\n";
+    OSS << "inline void thaw() noexcept {\n";
+    {
+        INDENT();
+        if (s.mCsrFreeze) {
+            OSS << "frozenOutOffsets.clear();\n";
+            OSS << "frozenOutEdges.clear();\n";
+            if (s.mBidirectional) {
+                OSS << "frozenInOffsets.clear();\n";
+                OSS << "frozenInEdges.clear();\n";
+            }
+        }
+        for (const auto& map : maps) {
+            OSS << map << ".thaw();\n";
+        }
+    }
+    OSS << "}\n";
+    if (s.mCsrFreeze) {
+        OSS << "inline bool frozen() const noexcept {\n";
+        OSS << "    return !frozenOutOffsets.empty();\n";
+        OSS << "}\n";
+    }
+
+    return oss.release();
+}
+
+std::pmr::string CppGraphBuilder::generateSlotMap_h() const {
+    CodeStream oss(get_allocator());
+    const auto& s = *mGraph;
+    if (!s.isSlotMap())
+        return oss.release();
+
+    std::pmr::string space(get_allocator());
+    oss << "\n";
+    OSS << "// SlotMap\n";
+    OSS << "// the generation of a slot is even while its vertex is alive, and odd once it is removed\n";
+    OSS << "struct SlotHandle {\n";
+    OSS << "    vertex_descriptor slot = null_vertex();\n";
+    OSS << "    uint32_t generation = 0;\n";
+    OSS << "};\n";
+    OSS << "inline bool alive(vertex_descriptor v) const noexcept {\n";
+    OSS << "    return (_generations[v] & 1) == 0;\n";
+    OSS << "}\n";
+    OSS << "inline SlotHandle getHandle(vertex_descriptor v) const noexcept {\n";
+    OSS << "    CC_EXPECTS(alive(v));\n";
+    OSS << "    return {v, _generations[v]};\n";
+    OSS << "}\n";
+    OSS << "inline bool valid(const SlotHandle& h) const noexcept {\n";
+    OSS << "    return h.slot < _generations.size() && _generations[h.slot] == h.generation;\n";
+    OSS << "}\n";
+
+    return oss.release();
+}
+
+std::pmr::string CppGraphBuilder::generateReset_h() const {
+    CodeStream oss(get_allocator());
+    const auto& s = *mGraph;
+    if (!s.isVector())
+        return oss.release();
+
+    std::pmr::string space(get_allocator());
+    std::pmr::string api(get_allocator());
+    if (!mStruct.mAPI.empty()) {
+        api = mStruct.mAPI;
+        api += "_API ";
+    }
+
+    oss << "\n";
+    if (canReset()) {
+        OSS << "// Reset, the graph is cleared and its top-level containers keep their capacity,\n";
+        OSS << "// the edge lists stored in the vertices are released with them\n";
+        OSS << api << "void reset();\n";
+    } else {
+        OSS << "// Reset\n";
+    }
+    if (canRebind()) {
+        OSS << "// the graph is rebuilt on another memory resource, e.g. a frame arena\n";
+        OSS << api << "void reset(const allocator_type& alloc) noexcept;\n";
+    }
+    OSS << api << "void shrink_to_fit();\n";
+
+    return oss.release();
+}
+
+std::pmr::string CppGraphBuilder::generateFragment_h() const {
+    CodeStream oss(get_allocator());
+    const auto& g = *mStruct.mSyntaxGraph;
+    const auto& s = *mGraph;
+    if (!s.mFragment)
+        return oss.release();
+
+    std::pmr::string space(get_allocator());
+    oss << "\n";
+    OSS << "// Fragment, filled apart with its own descriptors, then appended by merge\n";
+    OSS << "using Fragment = " << get(g.names, g, mStruct.mCurrentVertex) << ";\n";
+
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateTags_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& s = *mGraph;
     if (s.mComponents.empty()) {
-        return oss.str();
+        return oss.release();
     }
 
     std::pmr::string space(get_allocator());
@@ -1651,20 +1950,21 @@ std::pmr::string CppGraphBuilder::generateTags_h() const {
         ++count;
     }
     oss << "\n";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateMembers_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     copyString(oss, space, mStruct.generateMembers());
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateReserve_cpp() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
+    auto scratch = get_allocator().resource();
 
     auto hasReserve = [&]() {
         if (s.isVector())
@@ -1673,7 +1973,7 @@ std::pmr::string CppGraphBuilder::generateReserve_cpp() const {
     };
 
     if (!hasReserve())
-        return oss.str();
+        return oss.release();
 
     std::pmr::string space(get_allocator());
     auto structName = mStruct.getImplName();
@@ -1687,6 +1987,13 @@ std::pmr::string CppGraphBuilder::generateReserve_cpp() const {
         }
         if (s.isVector()) {
             OSS << "_vertices.reserve(sz);\n";
+            if (s.isSlotMap()) {
+                OSS << "_generations.reserve(sz);\n";
+            }
+            if (s.mOrderedDag) {
+                OSS << "_dagOrder.reserve(sz);\n";
+                OSS << "_dagRanks.reserve(sz);\n";
+            }
             for (const auto& c : s.mComponents) {
                 OSS << g.getMemberName(c.mMemberName, true) << ".reserve(sz);\n";
             }
@@ -1694,7 +2001,333 @@ std::pmr::string CppGraphBuilder::generateReserve_cpp() const {
     }
     OSS << "}\n";
 
-    return oss.str();
+    const auto members = getCapacityMembers();
+
+    oss << "\n";
+    OSS << "void " << structName << "::reserve(const GraphCapacityStats& stats) {\n";
+    {
+        INDENT();
+        OSS << "reserve(stats.vertices);\n";
+        for (const auto& member : members) {
+            OSS << member << ".reserve(stats." << getCapacityFieldName(member) << ");\n";
+        }
+        for (const auto& c : s.mPolymorphic.mConcepts) {
+            if (!s.hasObjectVertices(c)) {
+                continue;
+            }
+            const auto& member = g.getMemberName(c.mMemberName, true);
+            OSS << g.getMemberName(getObjectVerticesName(c.mTag, scratch), false)
+                << ".reserve(stats." << getCapacityFieldName(member) << ");\n";
+        }
+        if (s.mCsrFreeze) {
+            // per-vertex lists are allocated with their vertices, the totals size the frozen arrays
+            OSS << "frozenOutOffsets.reserve(stats.vertices + 1);\n";
+            OSS << "frozenOutEdges.reserve(stats.outEdges);\n";
+            if (s.mBidirectional) {
+                OSS << "frozenInOffsets.reserve(stats.vertices + 1);\n";
+                OSS << "frozenInEdges.reserve(stats.inEdges);\n";
+            }
+        }
+    }
+    OSS << "}\n";
+
+    oss << "\n";
+    OSS << "void " << structName << "::captureCapacity(GraphCapacityStats& stats) const noexcept {\n";
+    {
+        INDENT();
+        const auto capture = [&](std::string_view field, std::string_view member) {
+            OSS << "stats." << field << " = std::max(stats." << field
+                << ", gsl::narrow_cast<uint32_t>(" << member << ".size()));\n";
+        };
+        capture("vertices", "_vertices");
+        for (const auto& member : members) {
+            capture(getCapacityFieldName(member), member);
+        }
+        const auto captureTotals = [&](std::string_view container,
+                                       std::initializer_list<std::string_view> lists) {
+            oss << "\n";
+            OSS << "{\n";
+            {
+                INDENT();
+                for (const auto& list : lists) {
+                    OSS << "uint32_t " << list << " = 0;\n";
+                }
+                OSS << "for (const auto& elem : " << container << ") {\n";
+                for (const auto& list : lists) {
+                    OSS << "    " << list << " += gsl::narrow_cast<uint32_t>(elem." << list << ".size());\n";
+                }
+                OSS << "}\n";
+                for (const auto& list : lists) {
+                    OSS << "stats." << list << " = std::max(stats." << list << ", " << list << ");\n";
+                }
+            }
+            OSS << "}\n";
+        };
+        if (hasCapacityTotals()) {
+            if (s.mBidirectional) {
+                captureTotals("_vertices", { "outEdges", "inEdges" });
+            } else {
+                captureTotals("_vertices", { "outEdges" });
+            }
+        }
+    }
+    OSS << "}\n";
+
+    return oss.release();
+}
+
+// Lists reserved by GraphCapacityStats, besides the vertices and components.
+// Polymorphic values, hash indices, and vector or hash map members are included,
+// FrozenStringMap wraps a hash map.
+// The edge property list is a linked list and has nothing to reserve.
+// Out-edges, in-edges, children and parents are stored per vertex,
+// and allocated with their vertices, see hasCapacityTotals.
+std::pmr::vector<std::pmr::string> CppGraphBuilder::getCapacityMembers() const {
+    const auto& g = *mStruct.mSyntaxGraph;
+    const auto& s = *mGraph;
+    auto scratch = get_allocator().resource();
+    std::pmr::vector<std::pmr::string> members(get_allocator());
+
+    for (const auto& c : s.mPolymorphic.mConcepts) {
+        if (c.isVector() && !c.isIntrusive()) {
+            members.emplace_back(g.getMemberName(c.mMemberName, true));
+        }
+    }
+    for (const auto& map : s.mVertexMaps) {
+        if (map.mMapType.find("Unordered") != std::pmr::string::npos
+            || map.mMapType.ends_with("FrozenStringMap")) {
+            members.emplace_back(g.getMemberName(map.mMemberName, true));
+        }
+    }
+    for (const auto& m : s.mMembers) {
+        if ((m.mFlags & IMPL_DETAIL) || m.mPointer || m.mReference || m.mConst) {
+            continue;
+        }
+        const auto memberID = locate(m, g);
+        if (memberID == SyntaxGraph::null_vertex() || !holds_tag<Instance_>(memberID, g)) {
+            continue;
+        }
+        const auto templateID = g.getTemplate(memberID, scratch);
+        const auto& templateName = get(g.names, g, templateID);
+        if ((holds_tag<Container_>(templateID, g) && templateName == "vector")
+            || (holds_tag<Map_>(templateID, g)
+                && (templateName.find("Unordered") != std::pmr::string::npos
+                    || templateName.ends_with("FrozenStringMap")))) {
+            members.emplace_back(g.getMemberName(m.mMemberName, m.mPublic));
+        }
+    }
+    return members;
+}
+
+// Edge totals are only kept for CSR_FREEZE graphs, where they reserve the frozen arrays.
+bool CppGraphBuilder::hasCapacityTotals() const noexcept {
+    const auto& s = *mGraph;
+    return s.mCsrFreeze;
+}
+
+// FrozenStringMap members and indices, frozen and thawed with the graph
+std::pmr::vector<std::pmr::string> CppGraphBuilder::getFrozenStringMaps() const {
+    const auto& g = *mStruct.mSyntaxGraph;
+    const auto& s = *mGraph;
+    auto scratch = get_allocator().resource();
+    std::pmr::vector<std::pmr::string> maps(get_allocator());
+
+    for (const auto& map : s.mVertexMaps) {
+        if (map.mMapType.ends_with("FrozenStringMap")) {
+            maps.emplace_back(g.getMemberName(map.mMemberName, true));
+        }
+    }
+    for (const auto& m : s.mMembers) {
+        if ((m.mFlags & IMPL_DETAIL) || m.mPointer || m.mReference || m.mConst) {
+            continue;
+        }
+        const auto memberID = locate(m, g);
+        if (memberID == SyntaxGraph::null_vertex() || !holds_tag<Instance_>(memberID, g)) {
+            continue;
+        }
+        const auto templateID = g.getTemplate(memberID, scratch);
+        if (holds_tag<Map_>(templateID, g) && get(g.names, g, templateID).ends_with("FrozenStringMap")) {
+            maps.emplace_back(g.getMemberName(m.mMemberName, m.mPublic));
+        }
+    }
+    return maps;
+}
+
+std::string_view CppGraphBuilder::getCapacityFieldName(std::string_view member) const noexcept {
+    if (!member.empty() && member.front() == '_') {
+        member.remove_prefix(1);
+    }
+    return member;
+}
+
+std::pmr::string CppGraphBuilder::generateFrozenGraph_cpp() const {
+    CodeStream oss(get_allocator());
+    const auto& s = *mGraph;
+    const auto maps = getFrozenStringMaps();
+    if (!s.mCsrFreeze && maps.empty())
+        return oss.release();
+
+    std::pmr::string space(get_allocator());
+    auto structName = mStruct.getImplName();
+
+    // offsets[v] and offsets[v + 1] delimit the edges of v
+    auto freezeEdges = [&](std::string_view offsets, std::string_view edges, std::string_view list) {
+        OSS << offsets << ".clear();\n";
+        OSS << edges << ".clear();\n";
+        OSS << offsets << ".reserve(_vertices.size() + 1);\n";
+        OSS << edges << ".reserve(numEdges);\n";
+        OSS << offsets << ".emplace_back(0);\n";
+        OSS << "for (const auto& vert : _vertices) {\n";
+        OSS << "    " << edges << ".insert(" << edges << ".end(), vert." << list << ".begin(), vert." << list << ".end());\n";
+        OSS << "    " << offsets << ".emplace_back(gsl::narrow_cast<" << s.mEdgeSizeType << ">("
+            << edges << ".size()));\n";
+        OSS << "}\n";
+    };
+
+    oss << "\n";
+    OSS << "// FrozenGraph\n";
+    OSS << "void " << structName << "::freeze() {\n";
+    {
+        INDENT();
+        if (s.mCsrFreeze) {
+            OSS << "size_t numEdges = 0;\n";
+            OSS << "for (const auto& vert : _vertices) {\n";
+            OSS << "    numEdges += vert.outEdges.size();\n";
+            OSS << "}\n";
+            oss << "\n";
+            freezeEdges("frozenOutOffsets", "frozenOutEdges", "outEdges");
+            if (s.mBidirectional) {
+                oss << "\n";
+                freezeEdges("frozenInOffsets", "frozenInEdges", "inEdges");
+            }
+            if (!maps.empty()) {
+                oss << "\n";
+            }
+        }
+        for (const auto& map : maps) {
+            OSS << map << ".freeze();\n";
+        }
+    }
+    OSS << "}\n";
+
+    return oss.release();
+}
+
+// members released by a custom destructor cannot be cleared in place
+bool CppGraphBuilder::canReset() const {
+    const auto& g = *mStruct.mSyntaxGraph;
+    const auto& s = *mGraph;
+    const auto vertID = mStruct.mCurrentVertex;
+    const auto& traits = get(g.traits, g, vertID);
+    if (traits.mFlags & CUSTOM_DTOR) {
+        return false;
+    }
+    std::pmr::string dtor("~", get_allocator());
+    dtor += get(g.names, g, vertID);
+    dtor += "(";
+    for (const auto& content : s.mMemberFunctions) {
+        if (content.find(dtor) != std::pmr::string::npos) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool CppGraphBuilder::canRebind() const {
+    const auto& g = *mStruct.mSyntaxGraph;
+    const auto& s = *mGraph;
+    const auto vertID = mStruct.mCurrentVertex;
+    const auto& traits = get(g.traits, g, vertID);
+    return g.isPmr(vertID) && g.isNoexcept(vertID)
+        && !(traits.mFlags & CUSTOM_CNTR) && s.mConstructors.empty();
+}
+
+std::pmr::string CppGraphBuilder::generateReset_cpp() const {
+    CodeStream oss(get_allocator());
+    const auto& g = *mStruct.mSyntaxGraph;
+    const auto& s = *mGraph;
+    if (!s.isVector())
+        return oss.release();
+
+    std::pmr::string space(get_allocator());
+    auto scratch = get_allocator().resource();
+    auto name = get(g.names, g, mStruct.mCurrentVertex);
+    auto structName = mStruct.getImplName();
+
+    // containers are cleared, and vectors are shrunk,
+    // other members are left as they are
+    std::pmr::vector<std::pmr::string> cleared(scratch);
+    std::pmr::vector<std::pmr::string> shrunk(scratch);
+    for (const auto& m : s.mMembers) {
+        if (m.mPointer || m.mReference || m.mConst) {
+            continue;
+        }
+        const auto memberName = g.getMemberName(m.mMemberName, m.mPublic);
+        const auto memberID = locate(m, g);
+        if (memberID == SyntaxGraph::null_vertex()) {
+            // graph internal types, e.g. OutEdgeList
+            if (m.mFlags & IMPL_DETAIL) {
+                cleared.emplace_back(memberName);
+            }
+        } else if (g.isString(memberID)) {
+            cleared.emplace_back(memberName);
+            shrunk.emplace_back(memberName);
+        } else if (holds_tag<Instance_>(memberID, g)) {
+            const auto templateID = g.getTemplate(memberID, scratch);
+            if (holds_tag<Container_>(templateID, g)) {
+                cleared.emplace_back(memberName);
+                if (get(g.names, g, templateID) == "vector") {
+                    shrunk.emplace_back(memberName);
+                }
+            } else if (holds_tag<Map_>(templateID, g)) {
+                cleared.emplace_back(memberName);
+            }
+        } else if (m.mFlags & IMPL_DETAIL) {
+            cleared.emplace_back(memberName);
+        }
+    }
+    if (s.mCsrFreeze) {
+        // frozen arrays are vectors or small vectors, see Graph::isFreezable
+        shrunk.emplace_back(g.getMemberName("mFrozenOutOffsets", true));
+        shrunk.emplace_back(g.getMemberName("mFrozenOutEdges", true));
+        if (s.mBidirectional) {
+            shrunk.emplace_back(g.getMemberName("mFrozenInOffsets", true));
+            shrunk.emplace_back(g.getMemberName("mFrozenInEdges", true));
+        }
+    }
+
+    oss << "\n";
+    OSS << "// Reset\n";
+    if (canReset()) {
+        OSS << "void " << structName << "::reset() {\n";
+        {
+            INDENT();
+            for (const auto& member : cleared) {
+                OSS << member << ".clear();\n";
+            }
+        }
+        OSS << "}\n";
+        oss << "\n";
+    }
+
+    if (canRebind()) {
+        OSS << "void " << structName << "::reset(const allocator_type& alloc) noexcept {\n";
+        OSS << "    this->~" << name << "();\n";
+        OSS << "    ::new (static_cast<void*>(this)) " << name << "(alloc);\n";
+        OSS << "}\n";
+        oss << "\n";
+    }
+
+    OSS << "void " << structName << "::shrink_to_fit() {\n";
+    {
+        INDENT();
+        for (const auto& member : shrunk) {
+            OSS << member << ".shrink_to_fit();\n";
+        }
+    }
+    OSS << "}\n";
+
+    return oss.release();
 }
 
 }
@@ -37,7 +37,7 @@ std::string_view gNoDiscard = "";
 std::pmr::string pushIncidenceList(const Graph& s,
     std::string_view el, std::string_view v,
     std::string_view res, bool isEdgeListNotNeeded, std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     std::pmr::string edgeProperty(scratch);
@@ -73,7 +73,7 @@ std::pmr::string pushIncidenceList(const Graph& s,
             }),
         s.mOutEdgeListType);
 
-    return oss.str();
+    return oss.release();
 };
 
 std::pmr::string eraseFromIncidenceList(const Graph& s,
@@ -82,7 +82,7 @@ std::pmr::string eraseFromIncidenceList(const Graph& s,
     std::string_view p,
     bool bOut,
     std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     OSS << "// eraseFromIncidenceList\n";
@@ -115,12 +115,12 @@ std::pmr::string eraseFromIncidenceList(const Graph& s,
             }),
         s.mOutEdgeListType);
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string removeDirectedEdgeIf(const Graph& s,
     std::string_view outEdgeList, std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
     visit(
         overload(
@@ -131,12 +131,12 @@ std::pmr::string removeDirectedEdgeIf(const Graph& s,
                 OSS << "impl::associativeRemoveIncidenceEdgeIf(first, last, " << outEdgeList << ", std::forward<Predicate>(pred));\n";
             }),
         s.mOutEdgeListType);
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string clearOutEdges(const Graph& s, std::string_view name,
     bool referenceGraph, std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     Expects(s.mBidirectional);
@@ -175,12 +175,12 @@ std::pmr::string clearOutEdges(const Graph& s, std::string_view name,
     OSS << "}\n";
     OSS << "" << outEdgeList << ".clear();\n";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string clearInEdges(const Graph& s, std::string_view name,
     bool referenceGraph, std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     Expects(s.mBidirectional);
@@ -224,11 +224,11 @@ std::pmr::string clearInEdges(const Graph& s, std::string_view name,
     OSS << "}\n";
     OSS << "" << inEdgeList << ".clear();\n";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string clearVertex(const Graph& s, std::string_view name, std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     if (s.mUndirected) {
@@ -236,6 +236,9 @@ std::pmr::string clearVertex(const Graph& s, std::string_view name, std::pmr::me
             << name << "::vertex_descriptor u, " << name << "& g) noexcept {\n";
         {
             INDENT();
+            if (s.mCsrFreeze) {
+                OSS << "CC_EXPECTS(!g.frozen());\n";
+            }
             if (s.hasAddressIndex()) {
                 if (s.isAliasGraph()) {
                     Expects(s.mIncidence);
@@ -267,6 +270,9 @@ std::pmr::string clearVertex(const Graph& s, std::string_view name, std::pmr::me
             << name << "::vertex_descriptor u, " << name << "& g) noexcept { // NOLINT\n";
         {
             INDENT();
+            if (s.mCsrFreeze) {
+                OSS << "CC_EXPECTS(!g.frozen());\n";
+            }
             if (s.mIncidence) {
                 if (s.hasAddressIndex()) {
                     if (s.isAliasGraph()) {
@@ -307,6 +313,9 @@ std::pmr::string clearVertex(const Graph& s, std::string_view name, std::pmr::me
                 << name << "::vertex_descriptor u, " << name << "& g) noexcept { // NOLINT\n";
             {
                 INDENT();
+                if (s.mCsrFreeze) {
+                    OSS << "CC_EXPECTS(!g.frozen());\n";
+                }
                 if (s.hasAddressIndex()) {
                     if (s.isAliasGraph()) {
                         Expects(s.mIncidence);
@@ -339,7 +348,7 @@ std::pmr::string clearVertex(const Graph& s, std::string_view name, std::pmr::me
         OSS << "}\n";
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string removePolymorphicType(const SyntaxGraph& g, const CppGraphBuilder& builder,
@@ -347,7 +356,7 @@ std::pmr::string removePolymorphicType(const SyntaxGraph& g, const CppGraphBuild
     std::pmr::memory_resource* scratch) {
     Expects(s.isPolymorphic());
 
-    pmr_ostringstream oss(std::ios::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     const auto& cpp = builder.mStruct;
@@ -374,14 +383,29 @@ std::pmr::string removePolymorphicType(const SyntaxGraph& g, const CppGraphBuild
                         INDENT();
                         oss << "\n";
                         if (c.isVector()) {
-                            OSS << "g." << g.getMemberName(c.mMemberName, true) << ".erase(g."
-                                << g.getMemberName(c.mMemberName, true) << ".begin() + static_cast<std::ptrdiff_t>(h.value));\n";
-                            OSS << "if (h.value == g." << g.getMemberName(c.mMemberName, true) << ".size()) {\n";
+                            const auto& member = g.getMemberName(c.mMemberName, true);
+                            OSS << "g." << member << ".erase(g."
+                                << member << ".begin() + static_cast<std::ptrdiff_t>(h.value));\n";
+                            if (s.hasObjectVertices(c)) {
+                                const auto& vertices = g.getMemberName(getObjectVerticesName(c.mTag, scratch), false);
+                                OSS << "g." << vertices << ".erase(g."
+                                    << vertices << ".begin() + static_cast<std::ptrdiff_t>(h.value));\n";
+                            }
+                            OSS << "if (h.value == g." << member << ".size()) {\n";
                             OSS << "    return;\n";
                             OSS << "}\n";
-                            OSS << "impl::reindexVectorHandle<"
-                                << cpp.getDependentName(c.mTag)
-                                << ">(g._vertices, h.value);\n";
+                            if (s.hasObjectVertices(c)) {
+                                const auto& vertices = g.getMemberName(getObjectVerticesName(c.mTag, scratch), false);
+                                OSS << "// ObjectRanges, only the handles of the objects after h are shifted\n";
+                                OSS << "for (auto i = h.value; i != static_cast<vertex_descriptor>(g." << member << ".size()); ++i) {\n";
+                                OSS << "    --ccstd::get<" << builder.handleElemType(c, ns, true) << ">(\n";
+                                OSS << "        g._vertices[g." << vertices << "[i]].handle).value;\n";
+                                OSS << "}\n";
+                            } else {
+                                OSS << "impl::reindexVectorHandle<"
+                                    << cpp.getDependentName(c.mTag)
+                                    << ">(g._vertices, h.value);\n";
+                            }
                         } else {
                             OSS << "g." << g.getMemberName(c.mMemberName, true) << ".erase(h.value);\n";
                         }
@@ -397,20 +421,224 @@ std::pmr::string removePolymorphicType(const SyntaxGraph& g, const CppGraphBuild
     }
     OSS << "}\n";
 
-    return oss.str();
+    return oss.release();
+}
+
+// free slots of polymorphic graphs keep their value, it is reset when the vertex is removed,
+// and reused by the next vertex of the same type
+std::pmr::string recyclePolymorphicType(const SyntaxGraph& g, const CppGraphBuilder& builder,
+    const Graph& s, std::string_view name, bool reset,
+    std::pmr::memory_resource* scratch) {
+    Expects(s.isPolymorphic());
+    Expects(s.isSlotMap());
+
+    CodeStream oss(scratch);
+    std::pmr::string space(scratch);
+
+    auto ns = builder.mStruct.mCurrentNamespace;
+
+    if (reset) {
+        OSS << "inline void reset_vertex_value_impl(const ";
+    } else {
+        OSS << "inline void recycle_vertex_value_impl(const ";
+    }
+    oss << name << "::VertexHandle& h, " << name << "& g) { // NOLINT\n";
+    {
+        INDENT();
+        OSS << "using vertex_descriptor = " << name << "::vertex_descriptor;\n";
+
+        OSS << "ccstd::visit(\n";
+        {
+            INDENT();
+            OSS << "overload(\n";
+            {
+                INDENT();
+                int count = 0;
+                for (const auto& c : s.mPolymorphic.mConcepts) {
+                    if (count++)
+                        oss << ",\n";
+                    const auto& member = g.getMemberName(c.mMemberName, true);
+                    OSS << "[&](const " << builder.handleElemType(c, ns, true) << "& h) {\n";
+                    {
+                        INDENT();
+                        if (reset) {
+                            // construct in place of the old value, the container does not grow
+                            const auto valueID = locate(c, g);
+                            OSS << "g." << member << "[h.value] = "
+                                << builder.mStruct.getDependentName(c.mValue);
+                            if (g.isPmr(valueID)) {
+                                oss << "(g.get_allocator());\n";
+                            } else {
+                                oss << "{};\n";
+                            }
+                        } else {
+                            OSS << "g." << member << "[h.value] = std::move(g." << member << ".back());\n";
+                            OSS << "g." << member << ".pop_back();\n";
+                        }
+                    }
+                    OSS << "}";
+                }
+                oss << "),\n";
+            }
+            OSS << "h);\n";
+        }
+    }
+    OSS << "}\n";
+
+    return oss.release();
+}
+
+std::pmr::string popFreeSlot(const Graph& s, std::string_view name,
+    std::pmr::memory_resource* scratch) {
+    Expects(s.isSlotMap());
+
+    CodeStream oss(scratch);
+    std::pmr::string space(scratch);
+
+    if (s.isPolymorphic()) {
+        OSS << "inline " << name << "::vertex_descriptor popFreeSlotImpl(const "
+            << name << "::VertexHandle& h, " << name << "& g) noexcept {\n";
+        {
+            INDENT();
+            // one free list per value type, linked through _freeLinks
+            OSS << "const auto i = h.index();\n";
+            OSS << "if (i >= g._freeHeads.size() || g._freeHeads[i] == " << name << "::null_vertex()) {\n";
+            OSS << "    return " << name << "::null_vertex();\n";
+            OSS << "}\n";
+            OSS << "const auto v = g._freeHeads[i];\n";
+            OSS << "g._freeHeads[i] = g._freeLinks[v];\n";
+            OSS << "++g._generations[v];\n";
+            OSS << "return v;\n";
+        }
+        OSS << "}\n";
+    } else {
+        OSS << "inline " << name << "::vertex_descriptor popFreeSlotImpl("
+            << name << "& g) noexcept {\n";
+        {
+            INDENT();
+            OSS << "if (g._freeSlots.empty()) {\n";
+            OSS << "    return " << name << "::null_vertex();\n";
+            OSS << "}\n";
+            OSS << "const auto v = g._freeSlots.back();\n";
+            OSS << "g._freeSlots.pop_back();\n";
+            OSS << "++g._generations[v];\n";
+            OSS << "return v;\n";
+        }
+        OSS << "}\n";
+    }
+
+    return oss.release();
+}
+
+// the slot is only cleared, so descriptors of other vertices stay valid
+std::pmr::string removeSlotVertex(const CppGraphBuilder& builder,
+    const Graph& s, std::string_view name,
+    std::pmr::memory_resource* scratch) {
+    Expects(s.isSlotMap());
+
+    CodeStream oss(scratch);
+    std::pmr::string space(scratch);
+    const auto& g = *builder.mStruct.mSyntaxGraph;
+
+    OSS << "inline void remove_vertex("
+        << name << "::vertex_descriptor u, " << name << "& g) noexcept { // NOLINT\n";
+    {
+        INDENT();
+        OSS << "CC_EXPECTS(g.alive(u));\n";
+        if (s.mCsrFreeze) {
+            OSS << "CC_EXPECTS(!g.frozen());\n";
+        }
+        if (s.mAddressable && !s.isAliasGraph()) {
+            OSS << "{ // AddressableGraph (Separated)\n";
+            {
+                INDENT();
+                if (s.hasAddressIndex()) {
+                    OSS << "removePathImpl(u, g);\n";
+                }
+                OSS << "CC_EXPECTS(numChildren(u, g) == 0);\n";
+
+                oss << "\n";
+                copyString(oss, space, clearInEdges(s, name, true, scratch));
+            }
+            OSS << "}\n";
+        }
+        OSS << "clear_vertex(u, g);\n";
+
+        for (const auto& map : s.mVertexMaps) {
+            oss << "\n";
+            OSS << "{ // UuidGraph\n";
+            {
+                INDENT();
+                for (const auto& c : s.mComponents) {
+                    if (c.mName != map.mComponentName)
+                        continue;
+
+                    const auto& component = g.getMemberName(c.mMemberName, true);
+                    OSS << "const auto& key = g." << component << "[u];\n";
+                    OSS << "auto num = g." << g.getMemberName(map.mMemberName, true) << ".erase(key);\n";
+                    OSS << "CC_ENSURES(num == 1);\n";
+                    break;
+                }
+            }
+            OSS << "}\n";
+        }
+
+        if (!s.mComponents.empty()) {
+            oss << "\n";
+            OSS << "// release the component values, a dead slot keeps no memory\n";
+            for (const auto& c : s.mComponents) {
+                const auto& member = g.getMemberName(c.mMemberName, true);
+                const auto componentID = locate(c, g);
+                OSS << "g." << member << "[u] = " << builder.mStruct.getDependentName(c.mValuePath);
+                if (g.isPmr(componentID)) {
+                    oss << "(g.get_allocator());\n";
+                } else {
+                    oss << "{};\n";
+                }
+            }
+        }
+
+        if (s.isPolymorphic()) {
+            oss << "\n";
+            OSS << "// release the value, the slot keeps it for the next vertex of the same type\n";
+            OSS << "reset_vertex_value_impl(g._vertices[u].handle, g);\n";
+        }
+
+        oss << "\n";
+        OSS << "// SlotMap\n";
+        OSS << "++g._generations[u];\n";
+        if (s.isPolymorphic()) {
+            // _freeHeads and _freeLinks are sized by add_vertex
+            OSS << "const auto i = g._vertices[u].handle.index();\n";
+            OSS << "g._freeLinks[u] = g._freeHeads[i];\n";
+            OSS << "g._freeHeads[i] = u;\n";
+        } else {
+            OSS << "g._freeSlots.emplace_back(u);\n";
+        }
+    }
+    OSS << "}\n";
+
+    return oss.release();
 }
 
 std::pmr::string removeVertex(const CppGraphBuilder& builder,
     const Graph& s, std::string_view name,
     std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
     const auto& g = *builder.mStruct.mSyntaxGraph;
 
+    if (s.isSlotMap()) {
+        return removeSlotVertex(builder, s, name, scratch);
+    }
+
     OSS << "inline void remove_vertex("
         << name << "::vertex_descriptor u, " << name << "& g) noexcept { // NOLINT\n";
     {
         INDENT();
+        if (s.mCsrFreeze) {
+            OSS << "CC_EXPECTS(!g.frozen());\n";
+        }
 
         if (s.mAddressable) {
             if (!s.isAliasGraph()) {
@@ -460,75 +688,909 @@ std::pmr::string removeVertex(const CppGraphBuilder& builder,
             OSS << "remove_vertex_value_impl(" << vertName << ".handle, g);\n";
         }
 
-        visit(
-            overload(
-                [&](Vector_) {
-                    for (const auto& c : s.mComponents) {
-                        const auto& member = g.getMemberName(c.mMemberName, true);
-                        if (!s.isVector()) {
-                            auto iterName = getParameterName(c.mMemberName, scratch) + "Iter";
-                            OSS << "auto " << iterName << " = vert." << member << "Iter;\n";
-                        }
-                    }
-                    if (s.hasIteratorComponent()) {
-                        oss << "\n";
-                    }
-
-                    for (const auto& map : s.mVertexMaps) {
-                        OSS << "{ // UuidGraph\n";
-                        {
-                            INDENT();
-                            for (const auto& c : s.mComponents) {
-                                if (c.mName != map.mComponentName)
-                                    continue;
+        visit(
+            overload(
+                [&](Vector_) {
+                    for (const auto& c : s.mComponents) {
+                        const auto& member = g.getMemberName(c.mMemberName, true);
+                        if (!s.isVector()) {
+                            auto iterName = getParameterName(c.mMemberName, scratch) + "Iter";
+                            OSS << "auto " << iterName << " = vert." << member << "Iter;\n";
+                        }
+                    }
+                    if (s.hasIteratorComponent()) {
+                        oss << "\n";
+                    }
+
+                    for (const auto& map : s.mVertexMaps) {
+                        OSS << "{ // UuidGraph\n";
+                        {
+                            INDENT();
+                            for (const auto& c : s.mComponents) {
+                                if (c.mName != map.mComponentName)
+                                    continue;
+
+                                const auto& component = g.getMemberName(c.mMemberName, true);
+                                OSS << "const auto& key = g." << component << "[u];\n";
+                                OSS << "auto num = g." << g.getMemberName(map.mMemberName, true) << ".erase(key);\n";
+                                OSS << "CC_ENSURES(num == 1);\n";
+                                OSS << "for (auto&& pair : g." << g.getMemberName(map.mMemberName, true) << ") {\n";
+                                {
+                                    INDENT();
+                                    OSS << "auto& v = pair.second;\n";
+                                    OSS << "if (v > u) {\n";
+                                    OSS << "    --v;\n";
+                                    OSS << "}\n";
+                                }
+                                OSS << "}\n";
+                                break;
+                            }
+                        }
+                        OSS << "}\n";
+                    }
+
+                    OSS << "impl::removeVectorVertex(const_cast<" << name << "&>(g), u, "
+                        << name << "::directed_category{});\n";
+
+                    if (!s.mComponents.empty()) {
+                        oss << "\n";
+                        OSS << "// remove components\n";
+                        for (const auto& c : s.mComponents) {
+                            const auto& member = g.getMemberName(c.mMemberName, true);
+                            if (s.isVector()) {
+                                OSS << "g." << member << ".erase(g." << member << ".begin() + static_cast<std::ptrdiff_t>(u));\n";
+                            } else {
+                                auto iterName = getParameterPrefix(c.mMemberName, scratch) + "Iter";
+                                OSS << "g." << member << ".erase(" << iterName << ");\n";
+                            }
+                        }
+                    }
+
+                    if (s.hasPathTrie()) {
+                        const auto& children = g.getMemberName("mPathChildren", true);
+                        oss << "\n";
+                        OSS << "// AddressableGraph (Trie)\n";
+                        OSS << "g." << children << ".erase(g." << children << ".begin() + static_cast<std::ptrdiff_t>(u));\n";
+                        OSS << "for (auto&& nvp : g." << g.getMemberName(s.mAddressableConcept.mMemberName, true) << ") {\n";
+                        OSS << "    if (nvp.second > u) {\n";
+                        OSS << "        --nvp.second;\n";
+                        OSS << "    }\n";
+                        OSS << "}\n";
+                        OSS << "for (auto&& index : g." << children << ") {\n";
+                        OSS << "    for (auto&& nvp : index) {\n";
+                        OSS << "        if (nvp.second > u) {\n";
+                        OSS << "            --nvp.second;\n";
+                        OSS << "        }\n";
+                        OSS << "    }\n";
+                        OSS << "}\n";
+                    }
+
+                    if (s.mObjectRanges) {
+                        oss << "\n";
+                        OSS << "// ObjectRanges, vertices after u are shifted down\n";
+                        for (const auto& c : s.mPolymorphic.mConcepts) {
+                            if (!s.hasObjectVertices(c)) {
+                                continue;
+                            }
+                            OSS << "for (auto& v : g." << g.getMemberName(getObjectVerticesName(c.mTag, scratch), false) << ") {\n";
+                            OSS << "    if (v > u) {\n";
+                            OSS << "        --v;\n";
+                            OSS << "    }\n";
+                            OSS << "}\n";
+                        }
+                    }
+
+                    if (s.mOrderedDag) {
+                        oss << "\n";
+                        OSS << "// OrderedDag, the other vertices keep their relative order\n";
+                        OSS << "g._dagOrder.erase(g._dagOrder.begin() + static_cast<std::ptrdiff_t>(g._dagRanks[u]));\n";
+                        OSS << "g._dagRanks.pop_back();\n";
+                        OSS << "for (" << name << "::vertices_size_type i = 0; i != static_cast<"
+                            << name << "::vertices_size_type>(g._dagOrder.size()); ++i) {\n";
+                        OSS << "    auto& w = g._dagOrder[i];\n";
+                        OSS << "    if (w > u) {\n";
+                        OSS << "        --w;\n";
+                        OSS << "    }\n";
+                        OSS << "    g._dagRanks[w] = i;\n";
+                        OSS << "}\n";
+                    }
+                },
+                [&](auto) {
+                    OSS << "g._vertices.erase(vert.mPosition);\n";
+                    if (!s.mVertexMaps.empty()) {
+                        throw std::runtime_error("only vector vertex list support UuidGraph");
+                    }
+                }),
+            s.mVertexListType);
+    }
+    OSS << "}\n";
+
+    return oss.release();
+}
+
+// OrderedDag, the order is kept valid by add_edge, so it is never sorted from scratch.
+// Pearce-Kelly: only the vertices placed between the endpoints of a backward edge are visited.
+std::pmr::string updateTopologicalOrder(const CppGraphBuilder& builder,
+    const Graph& s, std::string_view name,
+    std::pmr::memory_resource* scratch) {
+    Expects(s.mOrderedDag);
+
+    CodeStream oss(scratch);
+    std::pmr::string space(scratch);
+    const auto& g = *builder.mStruct.mSyntaxGraph;
+    const bool bPmr = g.isPmr(builder.mStruct.mCurrentVertex);
+
+    std::pmr::string alloc(scratch);
+    if (bPmr) {
+        alloc = "g.get_allocator()";
+    }
+
+    OSS << "// vertices sorted so that every edge goes forward\n";
+    std::pmr::string vertexDescriptor(name, scratch);
+    vertexDescriptor.append("::vertex_descriptor");
+    OSS << "inline const " << builder.slotListType(vertexDescriptor) << "&\n";
+    OSS << "getTopologicalOrder(const " << name << "& g) noexcept {\n";
+    OSS << "    return g._dagOrder;\n";
+    OSS << "}\n";
+    oss << "\n";
+    OSS << "inline " << name << "::vertices_size_type\n";
+    OSS << "getTopologicalRank(" << name << "::vertex_descriptor v, const " << name << "& g) noexcept {\n";
+    OSS << "    return g._dagRanks[v];\n";
+    OSS << "}\n";
+
+    oss << "\n";
+    OSS << "// When v is placed before u, the vertices between them reachable from v,\n";
+    OSS << "// and those reaching u, are moved so that the ones reaching u come first.\n";
+    OSS << "// They reuse the positions they held, the other vertices are not moved.\n";
+    OSS << "// Returns false if v reaches u, the edge would close a cycle.\n";
+    OSS << "inline bool updateTopologicalOrderImpl(\n";
+    OSS << "    " << name << "::vertex_descriptor u,\n";
+    OSS << "    " << name << "::vertex_descriptor v, " << name << "& g) {\n";
+    {
+        INDENT();
+        OSS << "using vertex_descriptor = " << name << "::vertex_descriptor;\n";
+        OSS << "using vertices_size_type = " << name << "::vertices_size_type;\n";
+        OSS << "if (u == v) {\n";
+        OSS << "    return false;\n";
+        OSS << "}\n";
+        OSS << "const auto lb = g._dagRanks[v];\n";
+        OSS << "const auto ub = g._dagRanks[u];\n";
+        OSS << "if (ub < lb) {\n";
+        OSS << "    return true;\n";
+        OSS << "}\n";
+
+        const auto declareList = [&](std::string_view elemType, std::string_view var, std::string_view args) {
+            OSS << builder.slotListType(elemType) << " " << var;
+            if (args.empty() && !bPmr) {
+                oss << ";\n";
+                return;
+            }
+            oss << "(" << args;
+            if (bPmr) {
+                oss << (args.empty() ? "" : ", ") << alloc;
+            }
+            oss << ");\n";
+        };
+
+        oss << "\n";
+        OSS << "// affected region, visited is indexed by rank - lb\n";
+        declareList("bool", "visited", "ub - lb + 1, false");
+        declareList("vertex_descriptor", "forward", "");
+        declareList("vertex_descriptor", "backward", "");
+        declareList("vertex_descriptor", "stack", "");
+
+        oss << "\n";
+        OSS << "// vertices reachable from v, placed before u\n";
+        OSS << "visited[0] = true;\n";
+        OSS << "stack.emplace_back(v);\n";
+        OSS << "while (!stack.empty()) {\n";
+        {
+            INDENT();
+            OSS << "const auto w = stack.back();\n";
+            OSS << "stack.pop_back();\n";
+            OSS << "forward.emplace_back(w);\n";
+            OSS << "for (const auto& e : makeRange(out_edges(w, g))) {\n";
+            {
+                INDENT();
+                OSS << "const auto x = target(e, g);\n";
+                OSS << "if (x == u) {\n";
+                OSS << "    return false;\n";
+                OSS << "}\n";
+                OSS << "const auto rank = g._dagRanks[x];\n";
+                OSS << "if (rank < ub && !visited[rank - lb]) {\n";
+                OSS << "    visited[rank - lb] = true;\n";
+                OSS << "    stack.emplace_back(x);\n";
+                OSS << "}\n";
+            }
+            OSS << "}\n";
+        }
+        OSS << "}\n";
+
+        oss << "\n";
+        OSS << "// vertices reaching u, placed after v\n";
+        OSS << "visited[ub - lb] = true;\n";
+        OSS << "stack.emplace_back(u);\n";
+        OSS << "while (!stack.empty()) {\n";
+        {
+            INDENT();
+            OSS << "const auto w = stack.back();\n";
+            OSS << "stack.pop_back();\n";
+            OSS << "backward.emplace_back(w);\n";
+            OSS << "for (const auto& e : makeRange(in_edges(w, g))) {\n";
+            {
+                INDENT();
+                OSS << "const auto x = source(e, g);\n";
+                OSS << "const auto rank = g._dagRanks[x];\n";
+                OSS << "if (rank > lb && !visited[rank - lb]) {\n";
+                OSS << "    visited[rank - lb] = true;\n";
+                OSS << "    stack.emplace_back(x);\n";
+                OSS << "}\n";
+            }
+            OSS << "}\n";
+        }
+        OSS << "}\n";
+
+        oss << "\n";
+        OSS << "// both sets keep their inner order, backward is placed before forward\n";
+        OSS << "const auto byRank = [&g](vertex_descriptor a, vertex_descriptor b) {\n";
+        OSS << "    return g._dagRanks[a] < g._dagRanks[b];\n";
+        OSS << "};\n";
+        OSS << "std::sort(backward.begin(), backward.end(), byRank);\n";
+        OSS << "std::sort(forward.begin(), forward.end(), byRank);\n";
+        declareList("vertices_size_type", "ranks", "");
+        OSS << "ranks.reserve(backward.size() + forward.size());\n";
+        OSS << "for (const auto w : backward) {\n";
+        OSS << "    ranks.emplace_back(g._dagRanks[w]);\n";
+        OSS << "}\n";
+        OSS << "for (const auto w : forward) {\n";
+        OSS << "    ranks.emplace_back(g._dagRanks[w]);\n";
+        OSS << "}\n";
+        OSS << "std::sort(ranks.begin(), ranks.end());\n";
+        OSS << "backward.insert(backward.end(), forward.begin(), forward.end());\n";
+        OSS << "for (vertices_size_type i = 0; i != static_cast<vertices_size_type>(ranks.size()); ++i) {\n";
+        OSS << "    g._dagOrder[ranks[i]] = backward[i];\n";
+        OSS << "    g._dagRanks[backward[i]] = ranks[i];\n";
+        OSS << "}\n";
+        OSS << "return true;\n";
+    }
+    OSS << "}\n";
+
+    return oss.release();
+}
+
+// remove_vertex erases one vertex, and reindexes every edge list and handle after it.
+// The batched version builds the old to new descriptor table once,
+// then compacts vertices, components, objects and edge lists in one pass.
+std::pmr::string removeVertices(const CppGraphBuilder& builder,
+    const Graph& s, std::string_view name,
+    std::pmr::memory_resource* scratch) {
+    Expects(s.hasCompactingRemoval());
+
+    CodeStream oss(scratch);
+    std::pmr::string space(scratch);
+    const auto& g = *builder.mStruct.mSyntaxGraph;
+    const auto ns = builder.mStruct.mCurrentNamespace;
+    const bool bPmr = g.isPmr(builder.mStruct.mCurrentVertex);
+
+    std::pmr::string alloc(scratch);
+    if (bPmr) {
+        alloc = "g.get_allocator()";
+    }
+
+    if (s.isSlotMap()) {
+        OSS << "// SlotMap, descriptors are stable, so vertices are removed one by one\n";
+        OSS << "template <class Predicate>\n";
+        OSS << "inline void remove_vertex_if(Predicate&& pred, " << name << "& g) { // NOLINT\n";
+        {
+            INDENT();
+            OSS << "using vertex_descriptor = " << name << "::vertex_descriptor;\n";
+            OSS << "const auto numVertices = static_cast<vertex_descriptor>(g._vertices.size());\n";
+            OSS << "for (vertex_descriptor u = 0; u != numVertices; ++u) {\n";
+            OSS << "    if (g.alive(u) && pred(u)) {\n";
+            OSS << "        remove_vertex(u, g);\n";
+            OSS << "    }\n";
+            OSS << "}\n";
+        }
+        OSS << "}\n";
+
+        oss << "\n";
+        OSS << "template <class VertexRange>\n";
+        OSS << "inline void remove_vertices(const VertexRange& range, " << name << "& g) { // NOLINT\n";
+        OSS << "    for (const auto u : range) {\n";
+        OSS << "        remove_vertex(u, g);\n";
+        OSS << "    }\n";
+        OSS << "}\n";
+        return oss.release();
+    }
+
+    OSS << "// Vertices matching pred are removed with their edges, in one pass.\n";
+    OSS << "// The other vertices keep their order, and their descriptors are shifted down.\n";
+    OSS << "template <class Predicate>\n";
+    OSS << "inline void remove_vertex_if(Predicate&& pred, " << name << "& g) { // NOLINT\n";
+    {
+        INDENT();
+        OSS << "using vertex_descriptor = " << name << "::vertex_descriptor;\n";
+        if (s.mCsrFreeze) {
+            OSS << "CC_EXPECTS(!g.frozen());\n";
+        }
+        oss << "\n";
+        OSS << "// old to new descriptors, removed vertices are mapped to null_vertex\n";
+        OSS << "const auto numVertices = static_cast<vertex_descriptor>(g._vertices.size());\n";
+        OSS << builder.slotListType("vertex_descriptor") << " remap(" << alloc << ");\n";
+        OSS << "remap.reserve(numVertices);\n";
+        OSS << "vertex_descriptor numKept = 0;\n";
+        OSS << "for (vertex_descriptor u = 0; u != numVertices; ++u) {\n";
+        OSS << "    remap.emplace_back(pred(u) ? " << name << "::null_vertex() : numKept++);\n";
+        OSS << "}\n";
+        OSS << "if (numKept == numVertices) {\n";
+        OSS << "    return;\n";
+        OSS << "}\n";
+
+        oss << "\n";
+        OSS << "// kept elements are moved down to their new position, the tail is dropped\n";
+        OSS << "const auto compact = [](auto& container, const auto& indices) {\n";
+        {
+            INDENT();
+            OSS << "vertex_descriptor numElements = 0;\n";
+            OSS << "for (vertex_descriptor i = 0; i != static_cast<vertex_descriptor>(indices.size()); ++i) {\n";
+            {
+                INDENT();
+                OSS << "if (indices[i] == " << name << "::null_vertex()) {\n";
+                OSS << "    continue;\n";
+                OSS << "}\n";
+                OSS << "if (indices[i] != i) {\n";
+                OSS << "    container[indices[i]] = std::move(container[i]);\n";
+                OSS << "}\n";
+                OSS << "++numElements;\n";
+            }
+            OSS << "}\n";
+            OSS << "container.erase(container.begin() + static_cast<std::ptrdiff_t>(numElements), container.end());\n";
+        }
+        OSS << "};\n";
+        oss << "\n";
+        OSS << "// edges to removed vertices are dropped, the others are retargeted\n";
+        OSS << "const auto remapEdges = [&remap](auto& edges) {\n";
+        {
+            INDENT();
+            OSS << "auto dst = edges.begin();\n";
+            OSS << "for (auto src = edges.begin(); src != edges.end(); ++src) {\n";
+            {
+                INDENT();
+                OSS << "const auto v = remap[src->get_target()];\n";
+                OSS << "if (v == " << name << "::null_vertex()) {\n";
+                OSS << "    continue;\n";
+                OSS << "}\n";
+                OSS << "src->get_target() = v;\n";
+                OSS << "if (dst != src) {\n";
+                OSS << "    *dst = std::move(*src);\n";
+                OSS << "}\n";
+                OSS << "++dst;\n";
+            }
+            OSS << "}\n";
+            OSS << "edges.erase(dst, edges.end());\n";
+        }
+        OSS << "};\n";
+
+        if (s.mAddressable) {
+            oss << "\n";
+            OSS << "// AddressableGraph, children of removed vertices must be removed too\n";
+            OSS << "for (vertex_descriptor u = 0; u != numVertices; ++u) {\n";
+            {
+                INDENT();
+                OSS << "if (remap[u] != " << name << "::null_vertex()) {\n";
+                OSS << "    const auto p = parent(u, g);\n";
+                OSS << "    CC_EXPECTS(p == " << name << "::null_vertex() || remap[p] != "
+                    << name << "::null_vertex());\n";
+                OSS << "}\n";
+            }
+            OSS << "}\n";
+        }
+
+        const auto remapIndex = [&](std::string_view label, std::string_view member) {
+            oss << "\n";
+            OSS << "// " << label << "\n";
+            OSS << "for (auto iter = g." << member << ".begin(); iter != g." << member << ".end();) {\n";
+            {
+                INDENT();
+                OSS << "const auto v = remap[iter->second];\n";
+                OSS << "if (v == " << name << "::null_vertex()) {\n";
+                OSS << "    iter = g." << member << ".erase(iter);\n";
+                OSS << "} else {\n";
+                OSS << "    iter->second = v;\n";
+                OSS << "    ++iter;\n";
+                OSS << "}\n";
+            }
+            OSS << "}\n";
+        };
+        for (const auto& map : s.mVertexMaps) {
+            if (map.isBimap()) {
+                remapIndex("UuidGraph", g.getMemberName(map.mMemberName, true));
+            }
+        }
+        if (s.hasAddressIndex() && !holds_alternative<Direct_>(s.mAddressableConcept.mType)) {
+            remapIndex("AddressableGraph", g.getMemberName(s.mAddressableConcept.mMemberName, true));
+        }
+
+        if (s.isPolymorphic()) {
+            oss << "\n";
+            OSS << "// PolymorphicGraph, objects of removed vertices are marked, then compacted\n";
+            for (const auto& c : s.mPolymorphic.mConcepts) {
+                if (c.isIntrusive() || !c.isVector()) {
+                    continue;
+                }
+                const auto& member = g.getMemberName(c.mMemberName, true);
+                OSS << builder.slotListType("vertex_descriptor") << " " << member << "Remap("
+                    << "g." << member << ".size(), 0";
+                if (bPmr) {
+                    oss << ", " << alloc;
+                }
+                oss << ");\n";
+            }
+            OSS << "for (vertex_descriptor u = 0; u != numVertices; ++u) {\n";
+            {
+                INDENT();
+                OSS << "if (remap[u] != " << name << "::null_vertex()) {\n";
+                OSS << "    continue;\n";
+                OSS << "}\n";
+                OSS << "ccstd::visit(\n";
+                {
+                    INDENT();
+                    OSS << "overload(\n";
+                    {
+                        INDENT();
+                        int count = 0;
+                        for (const auto& c : s.mPolymorphic.mConcepts) {
+                            if (count++)
+                                oss << ",\n";
+                            const auto& member = g.getMemberName(c.mMemberName, true);
+                            OSS << "[&](const " << builder.handleElemType(c, ns, true) << "& h) {";
+                            if (!c.isIntrusive()) {
+                                oss << "\n";
+                                if (c.isVector()) {
+                                    OSS << "    " << member << "Remap[h.value] = " << name << "::null_vertex();\n";
+                                } else {
+                                    OSS << "    g." << member << ".erase(h.value);\n";
+                                }
+                                OSS;
+                            }
+                            oss << "}";
+                        }
+                        oss << "),\n";
+                    }
+                    OSS << "g._vertices[u].handle);\n";
+                }
+            }
+            OSS << "}\n";
+            oss << "\n";
+            OSS << "// marked objects are removed, the others are numbered in order\n";
+            OSS << "const auto compactObjects = [&compact](auto& objects, auto& indices) {\n";
+            {
+                INDENT();
+                OSS << "vertex_descriptor numObjects = 0;\n";
+                OSS << "for (auto& i : indices) {\n";
+                OSS << "    if (i != " << name << "::null_vertex()) {\n";
+                OSS << "        i = numObjects++;\n";
+                OSS << "    }\n";
+                OSS << "}\n";
+                OSS << "compact(objects, indices);\n";
+            }
+            OSS << "};\n";
+            for (const auto& c : s.mPolymorphic.mConcepts) {
+                if (c.isIntrusive() || !c.isVector()) {
+                    continue;
+                }
+                const auto& member = g.getMemberName(c.mMemberName, true);
+                OSS << "compactObjects(g." << member << ", " << member << "Remap);\n";
+                if (s.hasObjectVertices(c)) {
+                    OSS << "compact(g." << g.getMemberName(getObjectVerticesName(c.mTag, scratch), false)
+                        << ", " << member << "Remap);\n";
+                }
+            }
+        }
+
+        oss << "\n";
+        OSS << "// compact vertices\n";
+        OSS << "compact(g._vertices, remap);\n";
+        if (s.needReferenceEdges()) {
+            OSS << "compact(g.objects, remap);\n";
+        }
+        for (const auto& c : s.mComponents) {
+            OSS << "compact(g." << g.getMemberName(c.mMemberName, true) << ", remap);\n";
+        }
+        if (s.hasPathTrie()) {
+            OSS << "compact(g." << g.getMemberName("mPathChildren", true) << ", remap);\n";
+        }
+
+        oss << "\n";
+        OSS << "// remap edges and handles of kept vertices\n";
+        OSS << "for (vertex_descriptor u = 0; u != numKept; ++u) {\n";
+        {
+            INDENT();
+            OSS << "remapEdges(g._vertices[u].outEdges);\n";
+            if (s.mBidirectional) {
+                OSS << "remapEdges(g._vertices[u].inEdges);\n";
+            }
+            if (s.needReferenceEdges()) {
+                OSS << "remapEdges(g.objects[u].children);\n";
+                if (s.mBidirectional) {
+                    OSS << "remapEdges(g.objects[u].parents);\n";
+                }
+            }
+            if (s.hasPathTrie()) {
+                const auto& children = g.getMemberName("mPathChildren", true);
+                OSS << "for (auto iter = g." << children << "[u].begin(); iter != g." << children << "[u].end();) {\n";
+                {
+                    INDENT();
+                    OSS << "const auto v = remap[iter->second];\n";
+                    OSS << "if (v == " << name << "::null_vertex()) {\n";
+                    OSS << "    iter = g." << children << "[u].erase(iter);\n";
+                    OSS << "} else {\n";
+                    OSS << "    iter->second = v;\n";
+                    OSS << "    ++iter;\n";
+                    OSS << "}\n";
+                }
+                OSS << "}\n";
+            }
+            if (s.isPolymorphic()) {
+                OSS << "ccstd::visit(\n";
+                {
+                    INDENT();
+                    OSS << "overload(\n";
+                    {
+                        INDENT();
+                        int count = 0;
+                        for (const auto& c : s.mPolymorphic.mConcepts) {
+                            if (count++)
+                                oss << ",\n";
+                            const auto& member = g.getMemberName(c.mMemberName, true);
+                            auto handle = builder.handleElemType(c, ns, true);
+                            if (c.isIntrusive() || !c.isVector()) {
+                                OSS << "[](const " << handle << "&) {}";
+                            } else {
+                                OSS << "[&](" << handle << "& h) {\n";
+                                OSS << "    h.value = " << member << "Remap[h.value];\n";
+                                OSS << "}";
+                            }
+                        }
+                        oss << "),\n";
+                    }
+                    OSS << "g._vertices[u].handle);\n";
+                }
+            }
+        }
+        OSS << "}\n";
+
+        if (s.mObjectRanges) {
+            oss << "\n";
+            OSS << "// ObjectRanges, kept objects belong to kept vertices\n";
+            for (const auto& c : s.mPolymorphic.mConcepts) {
+                if (!s.hasObjectVertices(c)) {
+                    continue;
+                }
+                OSS << "for (auto& v : g." << g.getMemberName(getObjectVerticesName(c.mTag, scratch), false) << ") {\n";
+                OSS << "    v = remap[v];\n";
+                OSS << "}\n";
+            }
+        }
+
+        if (s.mOrderedDag) {
+            oss << "\n";
+            OSS << "// OrderedDag, kept vertices keep their relative order\n";
+            OSS << "vertex_descriptor numOrdered = 0;\n";
+            OSS << "for (vertex_descriptor i = 0; i != numVertices; ++i) {\n";
+            {
+                INDENT();
+                OSS << "const auto v = remap[g._dagOrder[i]];\n";
+                OSS << "if (v != " << name << "::null_vertex()) {\n";
+                OSS << "    g._dagOrder[numOrdered] = v;\n";
+                OSS << "    g._dagRanks[v] = numOrdered++;\n";
+                OSS << "}\n";
+            }
+            OSS << "}\n";
+            OSS << "g._dagOrder.resize(numKept);\n";
+            OSS << "g._dagRanks.resize(numKept);\n";
+        }
+    }
+    OSS << "}\n";
+
+    oss << "\n";
+    OSS << "template <class VertexRange>\n";
+    OSS << "inline void remove_vertices(const VertexRange& range, " << name << "& g) { // NOLINT\n";
+    {
+        INDENT();
+        OSS << builder.slotListType("bool") << " removed(g._vertices.size(), false";
+        if (bPmr) {
+            oss << ", " << alloc;
+        }
+        oss << ");\n";
+        OSS << "for (const auto u : range) {\n";
+        OSS << "    removed[u] = true;\n";
+        OSS << "}\n";
+        OSS << "remove_vertex_if([&removed](" << name << "::vertex_descriptor u) { return removed[u]; }, g);\n";
+    }
+    OSS << "}\n";
+
+    return oss.release();
+}
+
+// Fragments are graphs of the same type, built apart with their own descriptors.
+// They are appended in the order of the range, so the result does not depend on
+// which thread filled which fragment.
+std::pmr::string mergeFragments(const CppGraphBuilder& builder,
+    const Graph& s, std::string_view name,
+    std::pmr::memory_resource* scratch) {
+    Expects(s.isMergeable());
+
+    CodeStream oss(scratch);
+    std::pmr::string space(scratch);
+    const auto& g = *builder.mStruct.mSyntaxGraph;
+    const auto ns = builder.mStruct.mCurrentNamespace;
+
+    OSS << "// Fragments are appended in the order of the range, and left empty.\n";
+    OSS << "// Their descriptors are shifted past the vertices and objects already in g.\n";
+    OSS << "template <class FragmentRange>\n";
+    OSS << "inline void merge(FragmentRange&& fragments, " << name << "& g) { // NOLINT\n";
+    {
+        INDENT();
+        OSS << "using vertex_descriptor = " << name << "::vertex_descriptor;\n";
+        if (s.mCsrFreeze) {
+            OSS << "CC_EXPECTS(!g.frozen());\n";
+        }
+        oss << "\n";
+        OSS << "// elements are moved to the end of dst, then src is cleared\n";
+        OSS << "const auto append = [](auto& dst, auto& src) {\n";
+        OSS << "    dst.insert(dst.end(), std::make_move_iterator(src.begin()), std::make_move_iterator(src.end()));\n";
+        OSS << "    src.clear();\n";
+        OSS << "};\n";
+        oss << "\n";
+        OSS << "for (" << name << "& f : fragments) {\n";
+        {
+            INDENT();
+            OSS << "CC_EXPECTS(&f != &g);\n";
+            if (s.mCsrFreeze) {
+                OSS << "CC_EXPECTS(!f.frozen());\n";
+            }
+            OSS << "const auto offset = static_cast<vertex_descriptor>(g._vertices.size());\n";
+            OSS << "const auto shiftEdges = [offset](auto& edges) {\n";
+            OSS << "    for (auto& e : edges) {\n";
+            OSS << "        e.get_target() += offset;\n";
+            OSS << "    }\n";
+            OSS << "};\n";
+
+            if (s.isPolymorphic()) {
+                oss << "\n";
+                OSS << "// PolymorphicGraph, objects are appended after the objects of g\n";
+                for (const auto& c : s.mPolymorphic.mConcepts) {
+                    if (c.isIntrusive()) {
+                        continue;
+                    }
+                    const auto& member = g.getMemberName(c.mMemberName, true);
+                    OSS << "const auto " << member << "Offset = static_cast<vertex_descriptor>(g."
+                        << member << ".size());\n";
+                }
+            }
+
+            oss << "\n";
+            OSS << "for (auto& vert : f._vertices) {\n";
+            {
+                INDENT();
+                OSS << "shiftEdges(vert.outEdges);\n";
+                if (s.mBidirectional) {
+                    OSS << "shiftEdges(vert.inEdges);\n";
+                }
+                if (s.isPolymorphic()) {
+                    OSS << "ccstd::visit(\n";
+                    {
+                        INDENT();
+                        OSS << "overload(\n";
+                        {
+                            INDENT();
+                            int count = 0;
+                            for (const auto& c : s.mPolymorphic.mConcepts) {
+                                if (count++)
+                                    oss << ",\n";
+                                const auto& member = g.getMemberName(c.mMemberName, true);
+                                auto handle = builder.handleElemType(c, ns, true);
+                                if (c.isIntrusive()) {
+                                    OSS << "[](const " << handle << "&) {}";
+                                } else {
+                                    OSS << "[&](" << handle << "& h) {\n";
+                                    OSS << "    h.value += " << member << "Offset;\n";
+                                    OSS << "}";
+                                }
+                            }
+                            oss << "),\n";
+                        }
+                        OSS << "vert.handle);\n";
+                    }
+                }
+            }
+            OSS << "}\n";
+
+            if (s.mObjectRanges) {
+                oss << "\n";
+                OSS << "// ObjectRanges, vertices of the objects are shifted like the edges\n";
+                for (const auto& c : s.mPolymorphic.mConcepts) {
+                    if (!s.hasObjectVertices(c)) {
+                        continue;
+                    }
+                    OSS << "for (auto& v : f." << g.getMemberName(getObjectVerticesName(c.mTag, scratch), false) << ") {\n";
+                    OSS << "    v += offset;\n";
+                    OSS << "}\n";
+                }
+            }
+
+            if (s.needReferenceEdges()) {
+                OSS << "for (auto& obj : f.objects) {\n";
+                OSS << "    shiftEdges(obj.children);\n";
+                if (s.mBidirectional) {
+                    OSS << "    shiftEdges(obj.parents);\n";
+                }
+                OSS << "}\n";
+            }
+
+            for (const auto& map : s.mVertexMaps) {
+                if (!map.isBimap()) {
+                    continue;
+                }
+                const auto& member = g.getMemberName(map.mMemberName, true);
+                oss << "\n";
+                OSS << "// UuidGraph, keys must be unique across the fragments\n";
+                OSS << "for (const auto& [key, v] : f." << member << ") {\n";
+                OSS << "    auto res = g." << member << ".emplace(key, v + offset);\n";
+                OSS << "    CC_ENSURES(res.second);\n";
+                OSS << "}\n";
+                OSS << "f." << member << ".clear();\n";
+            }
+
+            if (s.hasAddressIndex()) {
+                const auto& member = g.getMemberName(s.mAddressableConcept.mMemberName, true);
+                visit(
+                    overload(
+                        [&](Direct_) {
+                        },
+                        [&](const auto&) {
+                            oss << "\n";
+                            OSS << "// AddressableGraph, top level paths must be unique across the fragments\n";
+                            OSS << "for (const auto& [path, v] : f." << member << ") {\n";
+                            OSS << "    auto res = g." << member << ".emplace(path, v + offset);\n";
+                            OSS << "    CC_ENSURES(res.second);\n";
+                            OSS << "}\n";
+                            OSS << "f." << member << ".clear();\n";
+                        }),
+                    s.mAddressableConcept.mType);
+                if (s.hasPathTrie()) {
+                    const auto& children = g.getMemberName("mPathChildren", true);
+                    OSS << "for (auto& index : f." << children << ") {\n";
+                    OSS << "    for (auto& nvp : index) {\n";
+                    OSS << "        nvp.second += offset;\n";
+                    OSS << "    }\n";
+                    OSS << "}\n";
+                }
+            }
+
+            oss << "\n";
+            OSS << "append(g._vertices, f._vertices);\n";
+            if (s.needReferenceEdges()) {
+                OSS << "append(g.objects, f.objects);\n";
+            }
+            for (const auto& c : s.mComponents) {
+                const auto& member = g.getMemberName(c.mMemberName, true);
+                OSS << "append(g." << member << ", f." << member << ");\n";
+            }
+            for (const auto& c : s.mPolymorphic.mConcepts) {
+                if (c.isIntrusive()) {
+                    continue;
+                }
+                const auto& member = g.getMemberName(c.mMemberName, true);
+                OSS << "append(g." << member << ", f." << member << ");\n";
+                if (s.hasObjectVertices(c)) {
+                    const auto& vertices = g.getMemberName(getObjectVerticesName(c.mTag, scratch), false);
+                    OSS << "append(g." << vertices << ", f." << vertices << ");\n";
+                }
+            }
+            if (s.hasPathTrie()) {
+                const auto& children = g.getMemberName("mPathChildren", true);
+                OSS << "append(g." << children << ", f." << children << ");\n";
+            }
+        }
+        OSS << "}\n";
+    }
+    OSS << "}\n";
+
+    return oss.release();
+}
+
+std::pmr::string computeLevels(const Graph& s, std::string_view name,
+    std::pmr::memory_resource* scratch) {
+    Expects(s.hasLevels());
+
+    CodeStream oss(scratch);
+    std::pmr::string space(scratch);
+
+    OSS << "// Kahn's algorithm, a vertex is placed one level after its last source.\n";
+    OSS << "// The graph must be acyclic, levels are allocated from scratch.\n";
+    OSS << "inline " << name << "::GraphLevels\n";
+    OSS << "computeLevels(const " << name << "& g, boost::container::pmr::memory_resource* scratch) {\n";
+    {
+        INDENT();
+        OSS << "using vertex_descriptor = " << name << "::vertex_descriptor;\n";
+        OSS << "const auto numVertices = num_vertices(g);\n";
+        OSS << name << "::GraphLevels levels(scratch);\n";
+        OSS << "ccstd::pmr::vector<" << name << "::vertices_size_type> inDegrees(numVertices, 0, scratch);\n";
+        OSS << "for (vertex_descriptor u = 0; u != numVertices; ++u) {\n";
+        OSS << "    for (const auto& e : makeRange(out_edges(u, g))) {\n";
+        OSS << "        ++inDegrees[target(e, g)];\n";
+        OSS << "    }\n";
+        OSS << "}\n";
+        oss << "\n";
+        OSS << "levels.vertices.reserve(numVertices);\n";
+        OSS << "levels.offsets.emplace_back(0);\n";
+        OSS << "for (vertex_descriptor u = 0; u != numVertices; ++u) {\n";
+        OSS << "    if (inDegrees[u] == 0) {\n";
+        OSS << "        levels.vertices.emplace_back(u);\n";
+        OSS << "    }\n";
+        OSS << "}\n";
+        OSS << "for (vertex_descriptor first = 0; first != levels.vertices.size();) {\n";
+        {
+            INDENT();
+            OSS << "const auto last = gsl::narrow_cast<vertex_descriptor>(levels.vertices.size());\n";
+            OSS << "levels.offsets.emplace_back(last);\n";
+            OSS << "for (auto i = first; i != last; ++i) {\n";
+            OSS << "    for (const auto& e : makeRange(out_edges(levels.vertices[i], g))) {\n";
+            OSS << "        const auto v = target(e, g);\n";
+            OSS << "        if (--inDegrees[v] == 0) {\n";
+            OSS << "            levels.vertices.emplace_back(v);\n";
+            OSS << "        }\n";
+            OSS << "    }\n";
+            OSS << "}\n";
+            OSS << "first = last;\n";
+        }
+        OSS << "}\n";
+        OSS << "CC_ENSURES(levels.vertices.size() == numVertices); // cycle found\n";
+        OSS << "return levels;\n";
+    }
+    OSS << "}\n";
+
+    return oss.release();
+}
 
-                                const auto& component = g.getMemberName(c.mMemberName, true);
-                                OSS << "const auto& key = g." << component << "[u];\n";
-                                OSS << "auto num = g." << g.getMemberName(map.mMemberName, true) << ".erase(key);\n";
-                                OSS << "CC_ENSURES(num == 1);\n";
-                                OSS << "for (auto&& pair : g." << g.getMemberName(map.mMemberName, true) << ") {\n";
-                                {
-                                    INDENT();
-                                    OSS << "auto& v = pair.second;\n";
-                                    OSS << "if (v > u) {\n";
-                                    OSS << "    --v;\n";
-                                    OSS << "}\n";
-                                }
-                                OSS << "}\n";
-                                break;
-                            }
-                        }
-                        OSS << "}\n";
-                    }
+std::pmr::string getCriticalPathLength(const Graph& s, std::string_view name,
+    std::pmr::memory_resource* scratch) {
+    Expects(s.hasLevels());
 
-                    OSS << "impl::removeVectorVertex(const_cast<" << name << "&>(g), u, "
-                        << name << "::directed_category{});\n";
+    CodeStream oss(scratch);
+    std::pmr::string space(scratch);
 
-                    if (!s.mComponents.empty()) {
-                        oss << "\n";
-                        OSS << "// remove components\n";
-                        for (const auto& c : s.mComponents) {
-                            const auto& member = g.getMemberName(c.mMemberName, true);
-                            if (s.isVector()) {
-                                OSS << "g." << member << ".erase(g." << member << ".begin() + static_cast<std::ptrdiff_t>(u));\n";
-                            } else {
-                                auto iterName = getParameterPrefix(c.mMemberName, scratch) + "Iter";
-                                OSS << "g." << member << ".erase(" << iterName << ");\n";
-                            }
-                        }
-                    }
-                },
-                [&](auto) {
-                    OSS << "g._vertices.erase(vert.mPosition);\n";
-                    if (!s.mVertexMaps.empty()) {
-                        throw std::runtime_error("only vector vertex list support UuidGraph");
-                    }
-                }),
-            s.mVertexListType);
+    OSS << "// The longest path weighted by weight(v), vertices are visited in level order.\n";
+    OSS << "// Unweighted, the critical path holds levels.offsets.size() - 1 vertices.\n";
+    OSS << "template <class WeightFunction>\n";
+    OSS << "inline auto getCriticalPathLength(\n";
+    OSS << "    const " << name << "& g, const " << name << "::GraphLevels& levels,\n";
+    OSS << "    WeightFunction&& weight, boost::container::pmr::memory_resource* scratch) {\n";
+    {
+        INDENT();
+        OSS << "using Weight = std::decay_t<decltype(weight(" << name << "::null_vertex()))>;\n";
+        OSS << "CC_EXPECTS(levels.vertices.size() == num_vertices(g));\n";
+        OSS << "// finish time of each vertex, starts at the latest finish of its sources\n";
+        OSS << "ccstd::pmr::vector<Weight> finish(num_vertices(g), Weight{}, scratch);\n";
+        OSS << "Weight length{};\n";
+        OSS << "for (const auto& u : levels.vertices) {\n";
+        {
+            INDENT();
+            OSS << "finish[u] += weight(u);\n";
+            OSS << "length = std::max(length, finish[u]);\n";
+            OSS << "for (const auto& e : makeRange(out_edges(u, g))) {\n";
+            OSS << "    const auto v = target(e, g);\n";
+            OSS << "    finish[v] = std::max(finish[v], finish[u]);\n";
+            OSS << "}\n";
+        }
+        OSS << "}\n";
+        OSS << "return length;\n";
     }
     OSS << "}\n";
 
-    return oss.str();
+    return oss.release();
 }
 
 }
@@ -536,7 +1598,7 @@ std::pmr::string removeVertex(const CppGraphBuilder& builder,
 std::pmr::string CppGraphBuilder::generateAddEdge(bool property,
     bool generic, bool variadic, bool reference, bool function) const {
 
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
@@ -562,6 +1624,19 @@ std::pmr::string CppGraphBuilder::generateAddEdge(bool property,
     bool isBidirectionalOnly = directed && bidirectional;
     bool isEdgeListNotNeeded = isDirectedOnly || (isBidirectionalOnly && !edgeProperty);
 
+    if (s.mCsrFreeze && !reference) {
+        OSS << "CC_EXPECTS(!g.frozen());\n";
+    }
+    if (s.mOrderedDag && function && !reference) {
+        OSS << "// OrderedDag, the order is repaired first.\n";
+        OSS << "// An edge that would close a cycle is not added, and false is returned.\n";
+        OSS << "const bool acyclic = updateTopologicalOrderImpl(u, v, g);\n";
+        OSS << "if (!acyclic) {\n";
+        OSS << "    return std::make_pair(" << name << "::edge_descriptor(), false);\n";
+        OSS << "}\n";
+        oss << "\n";
+    }
+
     // precondition, add edge
     if (isEdgeListNotNeeded) {
     } else {
@@ -569,7 +1644,7 @@ std::pmr::string CppGraphBuilder::generateAddEdge(bool property,
             overload(
                 [&](Vector_) {
                 },
-                [&](List_) {
+                [&]<Sequence_ T>(T) {
                     OSS << "auto edgeIter = g.edges.emplace(g.edges.end(), u, v";
                     if (hasProperty) {
                         if (generic) {
@@ -625,10 +1700,7 @@ std::pmr::string CppGraphBuilder::generateAddEdge(bool property,
     } else {
         visit(
             overload(
-                [](Vector_) {
-                    // do nothing
-                },
-                [](List_) {
+                []<Sequence_ T>(T) {
                     // do nothing
                 },
                 [&]<MultipleAssociative_ T>(T) {
@@ -662,9 +1734,7 @@ std::pmr::string CppGraphBuilder::generateAddEdge(bool property,
     if (!isEdgeListNotNeeded) {
         visit(
             overload(
-                  [&](Vector_) {
-                  },
-                  [&](List_) {
+                  [&]<Sequence_ T>(T) {
                   },
                   [&]<UniqueAssociative_ T>(T) {
                       needInserted = true;
@@ -806,11 +1876,11 @@ std::pmr::string CppGraphBuilder::generateAddEdge(bool property,
         UNINDENT();
         OSS << "}\n";
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateRemoveEdges(bool bInline) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
@@ -818,11 +1888,11 @@ std::pmr::string CppGraphBuilder::generateRemoveEdges(bool bInline) const {
     auto scratch = get_allocator().resource();
     const auto& cpp = mStruct;
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateRemoveEdge(bool bInline) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
@@ -830,11 +1900,11 @@ std::pmr::string CppGraphBuilder::generateRemoveEdge(bool bInline) const {
     auto scratch = get_allocator().resource();
     const auto& cpp = mStruct;
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateRemoveEdgeIter(bool bInline) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
@@ -842,11 +1912,11 @@ std::pmr::string CppGraphBuilder::generateRemoveEdgeIter(bool bInline) const {
     auto scratch = get_allocator().resource();
     const auto& cpp = mStruct;
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise, bool cpp14) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
@@ -856,6 +1926,8 @@ std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise,
     const auto* ptr = &s;
     auto name = cpp.getImplName();
     auto ns = mStruct.mCurrentNamespace;
+    // slot maps store vertices and components like vectors
+    const VertexListType vertexList = s.isSlotMap() ? Vector_{} : s.mVertexListType;
 
     if (cpp14 && s.isPolymorphic()) {
         for (const auto& c : s.mPolymorphic.mConcepts) {
@@ -890,6 +1962,11 @@ std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise,
                                 if (!c.isIntrusive()) {
                                     OSS << "g." << g.getMemberName(c.mMemberName, true) << ".emplace_back(std::forward<decltype(args)>(args)...);\n";
                                 }
+                                if (s.hasObjectVertices(c)) {
+                                    OSS << "// ObjectRanges, vert is the last vertex\n";
+                                    OSS << "g." << g.getMemberName(getObjectVerticesName(c.mTag, scratch), false)
+                                        << ".emplace_back(gsl::narrow_cast<" << name << "::vertex_descriptor>(g._vertices.size() - 1));\n";
+                                }
                             } else {
                                 if (!c.isIntrusive()) {
                                     OSS << "vert.handle = " << handleElemType(c, ns) << "{ g." << g.getMemberName(c.mMemberName, true)
@@ -929,6 +2006,11 @@ std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise,
                             }
                             oss << ");\n";
                         }
+                        if (s.hasObjectVertices(c)) {
+                            OSS << "// ObjectRanges, vert is the last vertex\n";
+                            OSS << "g." << g.getMemberName(getObjectVerticesName(c.mTag, scratch), false)
+                                << ".emplace_back(gsl::narrow_cast<" << name << "::vertex_descriptor>(g._vertices.size() - 1));\n";
+                        }
                     } else {
                         if (!c.isIntrusive()) {
                             OSS << "vert.handle = " << handleElemType(c, ns) << "{ g." << g.getMemberName(c.mMemberName, true)
@@ -1017,7 +2099,74 @@ std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise,
     oss << ") {\n";
     {
         INDENT();
-        if (s.isVector()) {
+        if (s.isSlotMap()) {
+            if (!cpp14) {
+                throw std::invalid_argument("SLOT_MAP: only cpp14 addVertex is supported");
+            }
+            if (s.mCsrFreeze) {
+                OSS << "CC_EXPECTS(!g.frozen());\n";
+            }
+            if (s.isPolymorphic()) {
+                OSS << "// SlotMap, the value is added first, a free slot holding the same type is reused\n";
+                if (g.isPmr(vertID) && s.mIncidence) {
+                    OSS << name << "::Vertex vert(g.get_allocator());\n";
+                } else {
+                    OSS << name << "::Vertex vert;\n";
+                }
+                oss << "\n";
+                OSS << "// PolymorphicGraph\n";
+                OSS << "// if no matching overloaded function is found, Type is not supported by PolymorphicGraph\n";
+                if (propertyParam && piecewise) {
+                    OSS << "addVertexImpl(tag, std::forward<ValueT>(val), g, vert);\n";
+                } else {
+                    OSS << "addVertexImpl(std::forward<ValueT>(val), g, vert);\n";
+                }
+                oss << "\n";
+                OSS << "auto v = popFreeSlotImpl(vert.handle, g);\n";
+            } else {
+                OSS << "// SlotMap, a free slot is reused before the vertex list grows\n";
+                OSS << "auto v = popFreeSlotImpl(g);\n";
+            }
+            OSS << "const bool reuse = v != " << name << "::null_vertex();\n";
+            OSS << "if (!reuse) {\n";
+            {
+                INDENT();
+                if (s.mVertexDescriptor == "uint16_t") {
+                    OSS << "CC_EXPECTS(g._vertices.size() < " << name << "::null_vertex());\n";
+                }
+                OSS << "v = gsl::narrow_cast<" << name << "::vertex_descriptor>(g._vertices.size());\n";
+                OSS << "g._generations.emplace_back(0);\n";
+                if (s.mReferenceGraph && !s.isAliasGraph()) {
+                    OSS << "g.objects.emplace_back();\n";
+                }
+                // remove_vertex is noexcept, free lists are sized here
+                if (s.isPolymorphic()) {
+                    OSS << "const auto i = vert.handle.index();\n";
+                    OSS << "if (i >= g._freeHeads.size()) {\n";
+                    OSS << "    g._freeHeads.resize(i + 1, " << name << "::null_vertex());\n";
+                    OSS << "}\n";
+                    OSS << "g._freeLinks.emplace_back(" << name << "::null_vertex());\n";
+                    OSS << "g._vertices.emplace_back(std::move(vert));\n";
+                } else {
+                    OSS << "g._vertices.emplace_back();\n";
+                    OSS << "if (g._freeSlots.capacity() < g._vertices.size()) {\n";
+                    OSS << "    g._freeSlots.reserve(g._vertices.capacity());\n";
+                    OSS << "}\n";
+                }
+            }
+            if (s.isPolymorphic()) {
+                OSS << "} else {\n";
+                OSS << "    recycle_vertex_value_impl(g._vertices[v].handle, g);\n";
+            }
+            OSS << "}\n";
+        } else if (s.isVector()) {
+            if (s.mCsrFreeze) {
+                OSS << "CC_EXPECTS(!g.frozen());\n";
+            }
+            if (s.mVertexDescriptor == "uint16_t") {
+                OSS << "// compact descriptors, null_vertex is never a valid vertex\n";
+                OSS << "CC_EXPECTS(g._vertices.size() < " << name << "::null_vertex());\n";
+            }
             OSS << "auto v = gsl::narrow_cast<" << name << "::vertex_descriptor>(g._vertices.size());\n";
             if (s.mReferenceGraph) {
                 if (!s.isAliasGraph()) {
@@ -1052,6 +2201,12 @@ std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise,
             if (s.hasIteratorComponent() || s.isPolymorphic()) {
                 OSS << "auto& vert = g._vertices.back();\n";
             }
+            if (s.mOrderedDag) {
+                oss << "\n";
+                OSS << "// OrderedDag, the vertex has no edges yet, it is placed last\n";
+                OSS << "g._dagOrder.emplace_back(v);\n";
+                OSS << "g._dagRanks.emplace_back(v);\n";
+            }
         } else {
             if (!s.mComponents.empty()) {
                 throw std::runtime_error("non vector components not supported yet");
@@ -1123,7 +2278,7 @@ std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise,
                                     [&]<Associative_ T1>(T1) {
                                         OSS << "    auto res = g." << mapMemberName << ".emplace(std::piecewise_construct, std::forward_as_tuple(args...), std::forward_as_tuple(&(*iter)));\n";
                                     }),
-                                s.mVertexListType);
+                                vertexList);
                             OSS << "    CC_ENSURES(res.second);\n";
                             OSS << "},\n";
                             OSS << "c" << componentID << ");\n";
@@ -1141,7 +2296,7 @@ std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise,
                                 [&]<Associative_ T1>(T1) {
                                     OSS << "auto res = g." << mapMemberName << ".emplace(std::piecewise_construct, uuid, std::forward_as_tuple(&(*iter)));\n";
                                 }),
-                            s.mVertexListType);
+                            vertexList);
                     }
                 } else {
                     OSS << "const auto& uuid = c" << componentID << ";\n";
@@ -1156,7 +2311,7 @@ std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise,
                             [&]<Associative_ U1>(U1) {
                                 OSS << "auto res = g." << mapMemberName << ".emplace(uuid, &(*iter));\n";
                             }),
-                        s.mVertexListType);
+                        vertexList);
                     OSS << "CC_ENSURES(res.second);\n";
                 }
             }
@@ -1199,9 +2354,24 @@ std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise,
                         throw std::runtime_error("non vector components not supported yet");
                     }
                 }),
-            s.mVertexListType);
+            vertexList);
 
-        if (s.isPolymorphic()) {
+        if (s.isSlotMap() && !s.mComponents.empty()) {
+            oss << "\n";
+            OSS << "if (reuse) {\n";
+            {
+                INDENT();
+                OSS << "// SlotMap, components are built in place, then moved into the free slot\n";
+                for (const auto& c : s.mComponents) {
+                    const auto& member = g.getMemberName(c.mMemberName, true);
+                    OSS << "g." << member << "[v] = std::move(g." << member << ".back());\n";
+                    OSS << "g." << member << ".pop_back();\n";
+                }
+            }
+            OSS << "}\n";
+        }
+
+        if (s.isPolymorphic() && !s.isSlotMap()) {
             if (cpp14) {
                 oss << "\n";
                 OSS << "// PolymorphicGraph\n";
@@ -1246,6 +2416,9 @@ std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise,
                                         if (!c.isIntrusive()) {
                                             OSS << "g." << g.getMemberName(c.mMemberName, true) << ".emplace_back(std::forward<decltype(args)>(args)...);\n";
                                         }
+                                        if (s.hasObjectVertices(c)) {
+                                            OSS << "g." << g.getMemberName(getObjectVerticesName(c.mTag, scratch), false) << ".emplace_back(v);\n";
+                                        }
                                     } else {
                                         if (!c.isIntrusive()) {
                                             OSS << "vert.handle = " << handleElemType(c, ns) << "{ g." << g.getMemberName(c.mMemberName, true)
@@ -1302,6 +2475,9 @@ std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise,
                                     }
                                     oss << ");\n";
                                 }
+                                if (s.hasObjectVertices(c)) {
+                                    OSS << "g." << g.getMemberName(getObjectVerticesName(c.mTag, scratch), false) << ".emplace_back(v);\n";
+                                }
                             } else {
                                 if (!c.isIntrusive()) {
                                     OSS << "vert.handle = " << handleElemType(c, ns) << "{ g." << g.getMemberName(c.mMemberName, true)
@@ -1345,15 +2521,15 @@ std::pmr::string CppGraphBuilder::addVertex(bool propertyParam, bool piecewise,
                     oss << "\n";
                     OSS << "return &(*iter);\n";
                 }),
-            s.mVertexListType);
+            vertexList);
     }
     OSS << "}\n";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateAddressableGraph(bool bInline) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
@@ -1486,11 +2662,11 @@ return isAncestor;
     }
     OSS << "}\n";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateGraphFunctions_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
@@ -1520,6 +2696,14 @@ std::pmr::string CppGraphBuilder::generateGraphFunctions_h() const {
         oss << "\n";
         OSS << "inline std::pair<" << name << "::out_edge_iterator, " << name << "::out_edge_iterator>\n";
         OSS << "out_edges(" << name << "::vertex_descriptor u, const " << name << "& g) noexcept { // NOLINT\n";
+        if (s.mCsrFreeze) {
+            OSS << "    if (g.frozen()) {\n";
+            OSS << "        auto iter = const_cast<" << name << "&>(g).frozenOutEdges.begin();\n";
+            OSS << "        return std::make_pair(\n";
+            OSS << "            " << name << "::out_edge_iterator(iter + g.frozenOutOffsets[u], u),\n";
+            OSS << "            " << name << "::out_edge_iterator(iter + g.frozenOutOffsets[u + 1], u));\n";
+            OSS << "    }\n";
+        }
         OSS << "    return std::make_pair(\n";
         OSS << "        " << name << "::out_edge_iterator(const_cast<" << name << "&>(g).getOutEdgeList(u).begin(), u),\n";
         OSS << "        " << name << "::out_edge_iterator(const_cast<" << name << "&>(g).getOutEdgeList(u).end(), u));\n";
@@ -1528,6 +2712,11 @@ std::pmr::string CppGraphBuilder::generateGraphFunctions_h() const {
         oss << "\n";
         OSS << "inline " << name << "::degree_size_type\n";
         OSS << "out_degree(" << name << "::vertex_descriptor u, const " << name << "& g) noexcept { // NOLINT\n";
+        if (s.mCsrFreeze) {
+            OSS << "    if (g.frozen()) {\n";
+            OSS << "        return g.frozenOutOffsets[u + 1] - g.frozenOutOffsets[u];\n";
+            OSS << "    }\n";
+        }
         OSS << "    return gsl::narrow_cast<" << name << "::degree_size_type>(g.getOutEdgeList(u).size());\n";
         OSS << "}\n";
 
@@ -1583,6 +2772,14 @@ std::pmr::string CppGraphBuilder::generateGraphFunctions_h() const {
             OSS << "// BidirectionalGraph(Directed)\n";
             OSS << "inline std::pair<" << name << "::in_edge_iterator, " << name << "::in_edge_iterator>\n";
             OSS << "in_edges(" << name << "::vertex_descriptor u, const " << name << "& g) noexcept { // NOLINT\n";
+            if (s.mCsrFreeze) {
+                OSS << "    if (g.frozen()) {\n";
+                OSS << "        auto iter = const_cast<" << name << "&>(g).frozenInEdges.begin();\n";
+                OSS << "        return std::make_pair(\n";
+                OSS << "            " << name << "::in_edge_iterator(iter + g.frozenInOffsets[u], u),\n";
+                OSS << "            " << name << "::in_edge_iterator(iter + g.frozenInOffsets[u + 1], u));\n";
+                OSS << "    }\n";
+            }
             OSS << "    return std::make_pair(\n";
             OSS << "        " << name << "::in_edge_iterator(const_cast<" << name << "&>(g).getInEdgeList(u).begin(), u),\n";
             oss << "        " << name << "::in_edge_iterator(const_cast<" << name << "&>(g).getInEdgeList(u).end(), u));\n";
@@ -1591,6 +2788,11 @@ std::pmr::string CppGraphBuilder::generateGraphFunctions_h() const {
             oss << "\n";
             OSS << "inline " << name << "::degree_size_type\n";
             OSS << "in_degree(" << name << "::vertex_descriptor u, const " << name << "& g) noexcept { // NOLINT\n";
+            if (s.mCsrFreeze) {
+                OSS << "    if (g.frozen()) {\n";
+                OSS << "        return g.frozenInOffsets[u + 1] - g.frozenInOffsets[u];\n";
+                OSS << "    }\n";
+            }
             OSS << "    return gsl::narrow_cast<" << name << "::degree_size_type>(g.getInEdgeList(u).size());\n";
             OSS << "}\n";
             oss << "\n";
@@ -1626,7 +2828,12 @@ std::pmr::string CppGraphBuilder::generateGraphFunctions_h() const {
         oss << "\n";
         OSS << "inline " << name << "::vertices_size_type\n";
         OSS << "num_vertices(const " << name << "& g) noexcept { // NOLINT\n";
-        OSS << "    return gsl::narrow_cast<" << name << "::vertices_size_type>(g.getVertexList().size());\n";
+        if (s.isSlotMap()) {
+            OSS << "    // free slots are counted, so that vertex descriptors stay below num_vertices\n";
+            OSS << "    return gsl::narrow_cast<" << name << "::vertices_size_type>(g._vertices.size());\n";
+        } else {
+            OSS << "    return gsl::narrow_cast<" << name << "::vertices_size_type>(g.getVertexList().size());\n";
+        }
         OSS << "}\n";
     }
 
@@ -1686,6 +2893,12 @@ std::pmr::string CppGraphBuilder::generateGraphFunctions_h() const {
             OSS << "}\n";
         }
 
+        if (s.mOrderedDag) {
+            oss << "\n";
+            OSS << "// OrderedDag\n";
+            copyString(oss, space, updateTopologicalOrder(*this, s, name, scratch));
+        }
+
         if (s.mMutableGraphEdge) {
             oss << "\n";
             OSS << "// MutableGraph(Edge)\n";
@@ -1705,6 +2918,9 @@ std::pmr::string CppGraphBuilder::generateGraphFunctions_h() const {
                 << name << "::vertex_descriptor v, " << name << "& g) noexcept { // NOLINT\n";
             {
                 INDENT();
+                if (s.mCsrFreeze) {
+                    OSS << "CC_EXPECTS(!g.frozen());\n";
+                }
                 if (false && s.mReferenceGraph && s.mAliasGraph && s.mNamed /* && s.mUniqueName*/) {
                     OSS << "Expects(detachable(v));\n";
                 }
@@ -1777,6 +2993,9 @@ std::pmr::string CppGraphBuilder::generateGraphFunctions_h() const {
                 OSS << "inline void remove_edge(" << name << "::out_edge_iterator outIter, " << name << "& g) noexcept { // NOLINT\n";
                 {
                     INDENT();
+                    if (s.mCsrFreeze) {
+                        OSS << "CC_EXPECTS(!g.frozen());\n";
+                    }
                     OSS << "auto e = *outIter;\n";
                     if (s.isVector()) {
                         OSS << "const auto u = source(e, g);\n";
@@ -1833,6 +3052,9 @@ std::pmr::string CppGraphBuilder::generateGraphFunctions_h() const {
             OSS << "inline void remove_edge(" << name << "::edge_descriptor e, " << name << "& g) noexcept { // NOLINT\n";
             {
                 INDENT();
+                if (s.mCsrFreeze) {
+                    OSS << "CC_EXPECTS(!g.frozen());\n";
+                }
                 if (s.needEdgeList()) {
                     if (s.isDirectedOnly()) {
                         Expects(false);
@@ -1884,13 +3106,32 @@ std::pmr::string CppGraphBuilder::generateGraphFunctions_h() const {
         OSS << "// MutableGraph(Vertex)\n";
         copyString(oss, space, clearVertex(s, name, scratch));
 
-        if (s.isPolymorphic()) {
+        if (s.isSlotMap()) {
+            if (s.isPolymorphic()) {
+                oss << "\n";
+                copyString(oss, space, recyclePolymorphicType(g, *this, s, name, true, scratch));
+                oss << "\n";
+                copyString(oss, space, recyclePolymorphicType(g, *this, s, name, false, scratch));
+            }
+            oss << "\n";
+            copyString(oss, space, popFreeSlot(s, name, scratch));
+        } else if (s.isPolymorphic()) {
             oss << "\n";
             copyString(oss, space, removePolymorphicType(g, *this, s, name, scratch));
         }
 
         oss << "\n";
         copyString(oss, space, removeVertex(*this, s, name, scratch));
+
+        if (s.hasCompactingRemoval()) {
+            oss << "\n";
+            copyString(oss, space, removeVertices(*this, s, name, scratch));
+        }
+
+        if (s.mFragment) {
+            oss << "\n";
+            copyString(oss, space, mergeFragments(*this, s, name, scratch));
+        }
     }
 
     if (s.mEdgeList && s.mMutableGraphEdge && s.hasEdgeProperty()) {
@@ -1931,15 +3172,23 @@ std::pmr::string CppGraphBuilder::generateGraphFunctions_h() const {
         copyString(oss, space, addVertex(true, true, true));
     }
 
+    if (s.hasLevels()) {
+        oss << "\n";
+        OSS << "// Levels\n";
+        copyString(oss, space, computeLevels(s, name, scratch));
+        oss << "\n";
+        copyString(oss, space, getCriticalPathLength(s, name, scratch));
+    }
+
     if (s.mReferenceGraph) {
         copyString(oss, space, generateAddressableGraph());
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateGraphBoostFunctions_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
@@ -2062,7 +3311,7 @@ std::pmr::string CppGraphBuilder::generateGraphBoostFunctions_h() const {
                 OSS << "};\n";
             }
 
-            auto valueID = locate(c.mValuePath, g);
+            auto valueID = locate(c, g);
             const auto& traits = get(g.traits, g, valueID);
             if (!traits.mImport) {
                 if (g.isComposition(valueID)) {
@@ -2226,11 +3475,11 @@ std::pmr::string CppGraphBuilder::generateGraphBoostFunctions_h() const {
             }
         }
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
@@ -2246,7 +3495,7 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
     auto modulePath = get_path(mStruct.mCurrentModule, *mStruct.mModuleGraph, scratch);
     
     if (!g.moduleHasGraph(modulePath))
-        return oss.str();
+        return oss.release();
 
     if (s.isVector()) {
         //-----------------------------------------
@@ -2278,6 +3527,19 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
             OSS << "    return {colors};\n";
             OSS << "}\n";
         }
+        if (s.hasPackedColorMap()) {
+            oss << "\n";
+            OSS << gNoDiscard << "inline impl::PackedColorMap<" << name << "::vertex_descriptor>\n";
+            OSS << "get(impl::PackedColors& colors, const " << name << "& /*g*/) noexcept {\n";
+            OSS << "    return {colors};\n";
+            OSS << "}\n";
+
+            oss << "\n";
+            OSS << gNoDiscard << "inline impl::VisitedBitsetMap<" << name << "::vertex_descriptor>\n";
+            OSS << "get(impl::VisitedBitset& visited, const " << name << "& /*g*/) noexcept {\n";
+            OSS << "    return {visited};\n";
+            OSS << "}\n";
+        }
     }
 
     const auto vpID = locate(s.mVertexProperty, g);
@@ -2410,7 +3672,7 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
             oss << "// Vertex Component\n";
 
             const auto& member = g.getMemberName(c.mMemberName, true);
-            auto componentID = locate(c.mValuePath, g);
+            auto componentID = locate(c, g);
 
             { // component tag getter
                 const auto& tagType = getTagType(c.mName, scratch);
@@ -2560,7 +3822,7 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
     if (s.isPolymorphic()) {
         oss << "\n";
         OSS << "// PolymorphicGraph\n";
-        if (holds_alternative<Vector_>(s.mVertexListType)) {
+        if (s.isVector()) {
             OSS << gNoDiscard << "inline " << name << "::vertices_size_type\n";
             OSS << "id(" << name << "::vertex_descriptor u, const " << name << "& g) noexcept {\n";
             {
@@ -3149,6 +4411,34 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
             generateGetIf(false);
             generateGetIf(true);
         }
+
+        if (s.mObjectRanges) {
+            oss << "\n";
+            OSS << "// ObjectRanges, the objects of a type in storage order, each with its vertex\n";
+            OSS << "template <class Tag>\n";
+            OSS << gNoDiscard << "inline auto\n";
+            OSS << "objects(" << name << "& g) noexcept;\n";
+            oss << "\n";
+            OSS << "template <class Tag>\n";
+            OSS << gNoDiscard << "inline auto\n";
+            OSS << "objects(const " << name << "& g) noexcept;\n";
+            for (const auto& c : s.mPolymorphic.mConcepts) {
+                if (!s.hasObjectVertices(c)) {
+                    continue;
+                }
+                const auto& member = g.getMemberName(c.mMemberName, true);
+                const auto& vertices = g.getMemberName(getObjectVerticesName(c.mTag, scratch), false);
+                for (const auto* qualifier : { "", "const " }) {
+                    oss << "\n";
+                    OSS << "template <>\n";
+                    OSS << gNoDiscard << "inline auto\n";
+                    OSS << "objects<" << cpp.getDependentName(c.mTag) << ">("
+                        << qualifier << name << "& g) noexcept {\n";
+                    OSS << "    return impl::makeObjectRange(g." << vertices << ", g." << member << ");\n";
+                    OSS << "}\n";
+                }
+            }
+        }
     } // Polymorphic
 
     bool hasPropertyMap = s.hasVertexProperty() || !s.mComponents.empty();
@@ -3566,6 +4856,46 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
             stringName = "std::pmr::string";
             viewName = "std::string_view";
         }
+        if (s.hasPathTrie()) {
+            const auto& roots = g.getMemberName(s.mAddressableConcept.mMemberName, true);
+            const auto& children = g.getMemberName("mPathChildren", true);
+            oss << "\n";
+            OSS << "// AddressableGraph (Trie), the path is resolved one segment at a time\n";
+            OSS << gNoDiscard << "inline " << name << "::vertex_descriptor\n";
+            OSS << "locatePathImpl(" << name << "::vertex_descriptor u, "
+                << viewName << " path, const " << name << "& g) noexcept {\n";
+            {
+                INDENT();
+                OSS << "while (!path.empty()) {\n";
+                {
+                    INDENT();
+                    OSS << "const auto pos = path.find('/');\n";
+                    OSS << "const auto segment = path.substr(0, pos);\n";
+                    OSS << "path = pos == " << viewName << "::npos ? " << viewName << "{} : path.substr(pos + 1);\n";
+                    OSS << "if (segment.empty() || (segment.size() == 1 && segment[0] == '.')) {\n";
+                    OSS << "    continue;\n";
+                    OSS << "}\n";
+                    OSS << "if (segment.size() == 2 && segment[0] == '.' && segment[1] == '.') {\n";
+                    OSS << "    if (u == " << name << "::null_vertex()) {\n";
+                    OSS << "        return " << name << "::null_vertex();\n";
+                    OSS << "    }\n";
+                    OSS << "    u = parent(u, g);\n";
+                    OSS << "    continue;\n";
+                    OSS << "}\n";
+                    OSS << "const auto& index = u == " << name << "::null_vertex() ? g."
+                        << roots << " : g." << children << "[u];\n";
+                    OSS << "auto iter = index.find(segment);\n";
+                    OSS << "if (iter == index.end()) {\n";
+                    OSS << "    return " << name << "::null_vertex();\n";
+                    OSS << "}\n";
+                    OSS << "u = iter->second;\n";
+                }
+                OSS << "}\n";
+                OSS << "return u;\n";
+            }
+            OSS << "}\n";
+        }
+
         oss << "\n";
         OSS << gNoDiscard << "inline " << name << "::vertex_descriptor\n";
         OSS << "locate(" << viewName << " absolute, const " << name << "& g) noexcept {\n";
@@ -3582,6 +4912,9 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
                         OSS << "    return iter->second;\n";
                         OSS << "}\n";
                         OSS << "return " << name << "::null_vertex();\n";
+                    },
+                    [&](Trie_) {
+                        OSS << "return locatePathImpl(" << name << "::null_vertex(), absolute, g);\n";
                     }),
                 s.mAddressableConcept.mType);
         }
@@ -3613,6 +4946,11 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
                             }
                             OSS << "impl::cleanPath(key);\n";
                             OSS << "return locate(key, g);\n";
+                        },
+                        [&](Trie_) {
+                            OSS << "CC_EXPECTS(!boost::algorithm::starts_with(relative, \"/\"));\n";
+                            OSS << "CC_EXPECTS(!boost::algorithm::ends_with(relative, \"/\"));\n";
+                            OSS << "return locatePathImpl(u, relative, g);\n";
                         }),
                     s.mAddressableConcept.mType);
             }
@@ -3630,6 +4968,18 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
         OSS << "    return locate(absolute, g) != " << name << "::null_vertex();\n";
         OSS << "}\n";
 
+        if (s.hasPathTrie()) {
+            oss << "\n";
+            OSS << "// children of u ordered by path segment, u is null_vertex for the top level\n";
+            OSS << gNoDiscard << "inline const " << pathIndexType(std::pmr::string(name, scratch) + "::vertex_descriptor") << "&\n";
+            OSS << "getPathChildren(" << name << "::vertex_descriptor u, const " << name << "& g) noexcept {\n";
+            OSS << "    if (u == " << name << "::null_vertex()) {\n";
+            OSS << "        return g." << g.getMemberName(s.mAddressableConcept.mMemberName, true) << ";\n";
+            OSS << "    }\n";
+            OSS << "    return g." << g.getMemberName("mPathChildren", true) << "[u];\n";
+            OSS << "}\n";
+        }
+
         if (s.isPolymorphic()) {
             oss << "\n";
             OSS << "template <class ValueT>\n";
@@ -3736,12 +5086,44 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
                                     OSS << "g.objects[u].mPathIterator = res.first;\n";
                                 }
                             }
+                        },
+                        [&](Trie_) {
+                            const auto& roots = g.getMemberName(s.mAddressableConcept.mMemberName, true);
+                            const auto& children = g.getMemberName("mPathChildren", true);
+                            oss << "\n";
+                            OSS << "// add to path trie, under the parent's segments\n";
+                            OSS << "if (g." << children << ".size() < num_vertices(g)) {\n";
+                            OSS << "    g." << children << ".resize(num_vertices(g));\n";
+                            OSS << "}\n";
+                            OSS << "auto& index = u == " << name << "::null_vertex() ? g."
+                                << roots << " : g." << children << "[u];\n";
+                            OSS << "auto res = index.emplace(get(get(boost::vertex_name, g), v), v);\n";
+                            OSS << "CC_ENSURES(res.second);\n";
                         }),
                     s.mAddressableConcept.mType);
             }
         }
         OSS << "}\n";
 
+        if (s.hasPathTrie()) {
+            oss << "\n";
+            OSS << "inline void removePathImpl(" << name << "::vertex_descriptor u, " << name << "& g) noexcept {\n";
+            {
+                INDENT();
+                const auto& children = g.getMemberName("mPathChildren", true);
+                OSS << "// only leaf node can be removed from the trie\n";
+                OSS << "CC_EXPECTS(g." << children << "[u].empty());\n";
+                OSS << "const auto p = parent(u, g);\n";
+                OSS << "auto& index = p == " << name << "::null_vertex() ? g."
+                    << g.getMemberName(s.mAddressableConcept.mMemberName, true)
+                    << " : g." << children << "[p];\n";
+                OSS << "auto iter = index.find(get(get(boost::vertex_name, g), u));\n";
+                OSS << "CC_EXPECTS(iter != index.end());\n";
+                OSS << "index.erase(iter);\n";
+            }
+            OSS << "}\n";
+        }
+
         if (s.mAddressable && holds_alternative<Map_>(s.mAddressableConcept.mType)) {
             oss << "\n";
             OSS << "inline void removePathImpl(" << name << "::vertex_descriptor u, " << name << "& g) noexcept {\n";
@@ -3768,6 +5150,9 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
                                         OSS << "g.pathIndex.erase(static_cast<const " << name << "::object_type*>(u)->mPathIterator);\n";
                                     }
                                 }
+                            },
+                            [&](Trie_) {
+                                Expects(false);
                             }),
                         s.mAddressableConcept.mType);
                 } else {
@@ -3786,7 +5171,7 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
                     OSS << "CC_EXPECTS(iter != g." << member << ".end());\n";
                     OSS << "g." << member << ".erase(iter);\n";
                 }
-                if (s.isVector()) {
+                if (s.isVector() && !s.isSlotMap()) {
                     OSS << "for (auto&& nvp : g." << member << ") {\n";
                     {
                         INDENT();
@@ -3804,13 +5189,32 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
         oss << "\n";
         copyString(oss, space, clearVertex(s, name, scratch));
 
-        if (s.isPolymorphic()) {
+        if (s.isSlotMap()) {
+            if (s.isPolymorphic()) {
+                oss << "\n";
+                copyString(oss, space, recyclePolymorphicType(g, *this, s, name, true, scratch));
+                oss << "\n";
+                copyString(oss, space, recyclePolymorphicType(g, *this, s, name, false, scratch));
+            }
+            oss << "\n";
+            copyString(oss, space, popFreeSlot(s, name, scratch));
+        } else if (s.isPolymorphic()) {
             oss << "\n";
             copyString(oss, space, removePolymorphicType(g, *this, s, name, scratch));
         }
 
         oss << "\n";
         copyString(oss, space, removeVertex(*this, s, name, scratch));
+
+        if (s.hasCompactingRemoval()) {
+            oss << "\n";
+            copyString(oss, space, removeVertices(*this, s, name, scratch));
+        }
+
+        if (s.mFragment) {
+            oss << "\n";
+            copyString(oss, space, mergeFragments(*this, s, name, scratch));
+        }
     }
 
     if (s.mVertexList && s.mMutableGraphVertex && s.mReferenceGraph
@@ -3879,7 +5283,7 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
                     }
                 } else {
                     const auto& c = s.getComponent(s.mNamedConcept.mComponentName);
-                    auto comID = locate(c.mValuePath, g);
+                    auto comID = locate(c, g);
                     if (s.mNamedConcept.mComponentMemberName.empty()) {
                         Expects(g.isString(comID));
                         if (g.isUtf8(comID)) {
@@ -3991,7 +5395,7 @@ std::pmr::string CppGraphBuilder::generateGraphPropertyMaps_h() const {
         }
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 namespace {
@@ -4105,7 +5509,7 @@ void outputVectorGraphLoad(std::ostream& oss, std::pmr::string& space,
             std::pmr::string tagName(c.mName, scratch);
             tagName.pop_back();
             auto tagVar = getTagVariableName(c.mName, scratch);
-            auto valueID = locate(c.mValuePath, g);
+            auto valueID = locate(c, g);
             auto valueName = g.getDependentCppName(ns, valueID, scratch, scratch);
 
             OSS << valueName << " " << tagVar;
@@ -4133,7 +5537,7 @@ void outputVectorGraphLoad(std::ostream& oss, std::pmr::string& space,
                     OSS << "case " << conceptID++ << ": {\n";
                     {
                         INDENT();
-                        auto typeID = locate(c.mValue, g);
+                        auto typeID = locate(c, g);
                         auto typeName = g.getDependentCppName(ns, typeID, scratch, scratch);
                         OSS << typeName << " val";
                         if (g.isPmr(typeID)) {
@@ -4145,7 +5549,7 @@ void outputVectorGraphLoad(std::ostream& oss, std::pmr::string& space,
                         uint32_t count = 0;
                         OSS << "addVertex(";
                         for (const auto& c : s.mComponents) {
-                            auto componentID = locate(c.mValuePath, g);
+                            auto componentID = locate(c, g);
                             auto componentName = getTagVariableName(c.mName, scratch);
                             if (count++) {
                                 oss << ", ";
@@ -4181,7 +5585,7 @@ void outputVectorGraphLoad(std::ostream& oss, std::pmr::string& space,
             uint32_t count = 0;
             OSS << "addVertex(";
             for (const auto& c : s.mComponents) {
-                auto componentID = locate(c.mValuePath, g);
+                auto componentID = locate(c, g);
                 auto componentName = getTagVariableName(c.mName, scratch);
                 if (count++) {
                     oss << ", ";
@@ -4214,7 +5618,7 @@ void outputVectorGraphLoad(std::ostream& oss, std::pmr::string& space,
 } // namespace
 
 std::pmr::string CppGraphBuilder::generateGraphSerialization_h(bool nvp) const {
-    pmr_ostringstream oss(std::ios::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
     const auto& g = *mStruct.mSyntaxGraph;
     const auto& s = *mGraph;
@@ -4224,6 +5628,16 @@ std::pmr::string CppGraphBuilder::generateGraphSerialization_h(bool nvp) const {
     auto ns = mStruct.mCurrentNamespace;
     auto name = cpp.getDependentName(cpp.mCurrentPath);
 
+    if (s.isSlotMap()) {
+        throw std::invalid_argument("SLOT_MAP: graph serialization not supported yet");
+    }
+    if (s.mOrderedDag) {
+        throw std::invalid_argument("ORDERED_DAG_GRAPH: graph serialization not supported yet");
+    }
+    if (s.mObjectRanges) {
+        throw std::invalid_argument("OBJECT_RANGES: graph serialization not supported yet");
+    }
+
     bool bListVertexList = false;
     bool bContinuousOutEdgeList = false;
     if (!s.isVector()) {
@@ -4236,6 +5650,9 @@ std::pmr::string CppGraphBuilder::generateGraphSerialization_h(bool nvp) const {
             [&](Vector_) {
                 bContinuousOutEdgeList = true;
             },
+            [&](SmallVector_) {
+                bContinuousOutEdgeList = true;
+            },
             [&](auto) {
 
             }),
@@ -4294,7 +5711,7 @@ std::pmr::string CppGraphBuilder::generateGraphSerialization_h(bool nvp) const {
     }
     OSS << "}\n";
 
-    return oss.str();
+    return oss.release();
 }
 
 }
@@ -0,0 +1,737 @@
+#include "CppBuilder.h"
+
+namespace Cocos::Meta {
+
+namespace {
+
+// Engine ports of the helpers in Cocos/GraphTypes.h and Cocos/GraphImpl.h,
+// the engine is built as C++17, with boost pmr containers.
+
+void outputPackedColors(std::ostream& oss) {
+    oss << R"(
+// Colors packed in 2 bits per vertex, a 16th of a default_color_type vector.
+// White is zero, so the colors are cleared a word at a time.
+struct PackedColors {
+    using allocator_type = boost::container::pmr::polymorphic_allocator<char>;
+
+    PackedColors(size_t numVertices, const allocator_type& alloc)
+    : words((numVertices + 31) / 32, 0, alloc) {}
+
+    void clear() noexcept {
+        std::fill(words.begin(), words.end(), 0);
+    }
+
+    ccstd::pmr::vector<uint64_t> words;
+};
+
+// One bit per vertex, for traversals that only mark the vertices reached.
+struct VisitedBitset {
+    using allocator_type = boost::container::pmr::polymorphic_allocator<char>;
+
+    VisitedBitset(size_t numVertices, const allocator_type& alloc)
+    : words((numVertices + 63) / 64, 0, alloc) {}
+
+    bool test(size_t v) const noexcept {
+        return (words[v / 64] >> (v % 64)) & 1;
+    }
+    void set(size_t v) noexcept {
+        words[v / 64] |= uint64_t(1) << (v % 64);
+    }
+    void reset(size_t v) noexcept {
+        words[v / 64] &= ~(uint64_t(1) << (v % 64));
+    }
+    void clear() noexcept {
+        std::fill(words.begin(), words.end(), 0);
+    }
+
+    ccstd::pmr::vector<uint64_t> words;
+};
+
+// colors are unpacked on read, so the map has no lvalue
+template <class Key>
+struct PackedColorMap {
+    using value_type = boost::two_bit_color_type;
+    using reference = boost::two_bit_color_type;
+    using key_type = Key;
+    using category = boost::read_write_property_map_tag;
+
+    PackedColorMap(PackedColors& colors) noexcept // NOLINT
+    : colors(&colors) {}
+
+    PackedColors* colors = nullptr;
+};
+
+template <class Key>
+inline boost::two_bit_color_type get(const PackedColorMap<Key>& pm, const Key& v) noexcept {
+    const auto shift = (v % 32) * 2;
+    return static_cast<boost::two_bit_color_type>((pm.colors->words[v / 32] >> shift) & 3);
+}
+
+template <class Key>
+inline void put(const PackedColorMap<Key>& pm, const Key& v, boost::two_bit_color_type color) noexcept {
+    const auto shift = (v % 32) * 2;
+    auto& word = pm.colors->words[v / 32];
+    word = (word & ~(uint64_t(3) << shift)) | (static_cast<uint64_t>(color) << shift);
+}
+
+template <class Key>
+struct VisitedBitsetMap {
+    using value_type = bool;
+    using reference = bool;
+    using key_type = Key;
+    using category = boost::read_write_property_map_tag;
+
+    VisitedBitsetMap(VisitedBitset& visited) noexcept // NOLINT
+    : visited(&visited) {}
+
+    VisitedBitset* visited = nullptr;
+};
+
+template <class Key>
+inline bool get(const VisitedBitsetMap<Key>& pm, const Key& v) noexcept {
+    return pm.visited->test(v);
+}
+
+template <class Key>
+inline void put(const VisitedBitsetMap<Key>& pm, const Key& v, bool visited) noexcept {
+    if (visited) {
+        pm.visited->set(v);
+    } else {
+        pm.visited->reset(v);
+    }
+}
+)";
+}
+
+void outputEdgePool(std::ostream& oss) {
+    oss << R"(
+inline uint32_t countTrailingZeros(uint64_t bits) noexcept {
+    CC_EXPECTS(bits);
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index = 0;
+    _BitScanForward64(&index, bits);
+    return static_cast<uint32_t>(index);
+#else
+    return static_cast<uint32_t>(__builtin_ctzll(bits));
+#endif
+}
+
+inline uint32_t countLeadingZeros(uint64_t bits) noexcept {
+    CC_EXPECTS(bits);
+#if defined(_MSC_VER) && !defined(__clang__)
+    unsigned long index = 0;
+    _BitScanReverse64(&index, bits);
+    return static_cast<uint32_t>(63 - index);
+#else
+    return static_cast<uint32_t>(__builtin_clzll(bits));
+#endif
+}
+
+// Edges allocated in blocks of 64 slots, an erased edge leaves a free slot for the next one.
+// Blocks never move, so iterators and edge properties stay valid until the edge is erased.
+// Iteration walks the blocks in slot order and skips the free slots with the alive masks,
+// so edges(g) follows slot order, not insertion order.
+template <class T, class Allocator>
+class EdgePool {
+    static constexpr uint32_t BLOCK_SIZE = 64;
+
+    struct Block {
+        alignas(T) std::byte storage[sizeof(T) * BLOCK_SIZE];
+    };
+
+    using value_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+    using value_traits = std::allocator_traits<value_allocator>;
+    using block_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Block>;
+    using block_traits = std::allocator_traits<block_allocator>;
+
+    template <class Value, class Pool>
+    class Iterator : public boost::iterator_facade<
+                         Iterator<Value, Pool>, Value, std::bidirectional_iterator_tag> {
+    public:
+        Iterator() = default;
+        Iterator(Pool* pool, uint32_t slot) noexcept
+        : _pool(pool), _slot(slot) {}
+        template <class V, class P>
+        Iterator(const Iterator<V, P>& rhs) noexcept // NOLINT
+        : _pool(rhs._pool), _slot(rhs._slot) {}
+
+    private:
+        friend class boost::iterator_core_access;
+        friend class EdgePool;
+        template <class V, class P>
+        friend class Iterator;
+
+        Value& dereference() const noexcept {
+            return *_pool->data(_slot);
+        }
+        template <class V, class P>
+        bool equal(const Iterator<V, P>& rhs) const noexcept {
+            return _slot == rhs._slot;
+        }
+        void increment() noexcept {
+            _slot = _pool->nextAlive(_slot + 1);
+        }
+        void decrement() noexcept {
+            _slot = _pool->prevAlive(_slot - 1);
+        }
+
+        Pool* _pool = nullptr;
+        uint32_t _slot = 0;
+    };
+
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using size_type = uint32_t;
+    using difference_type = std::ptrdiff_t;
+    using allocator_type = Allocator;
+    using iterator = Iterator<T, EdgePool>;
+    using const_iterator = Iterator<const T, const EdgePool>;
+
+    EdgePool() = default;
+    explicit EdgePool(const allocator_type& alloc) noexcept
+    : _blocks(alloc), _alive(alloc), _free(alloc), _allocator(alloc) {}
+    EdgePool(EdgePool&& rhs) noexcept
+    : _blocks(std::move(rhs._blocks)),
+      _alive(std::move(rhs._alive)),
+      _free(std::move(rhs._free)),
+      _size(std::exchange(rhs._size, 0)),
+      _allocator(rhs._allocator) {}
+    EdgePool(EdgePool&& rhs, const allocator_type& alloc)
+    : EdgePool(alloc) {
+        if (_allocator == rhs._allocator) {
+            swap(rhs);
+        } else {
+            assign(std::move(rhs));
+        }
+    }
+    EdgePool(const EdgePool& rhs)
+    : EdgePool(rhs, value_traits::select_on_container_copy_construction(rhs._allocator)) {}
+    EdgePool(const EdgePool& rhs, const allocator_type& alloc)
+    : EdgePool(alloc) {
+        assign(rhs);
+    }
+    EdgePool& operator=(EdgePool&& rhs) {
+        if (this != &rhs) {
+            if (_allocator == rhs._allocator) {
+                EdgePool(std::move(rhs)).swap(*this);
+            } else {
+                assign(std::move(rhs));
+            }
+        }
+        return *this;
+    }
+    EdgePool& operator=(const EdgePool& rhs) {
+        if (this != &rhs) {
+            assign(rhs);
+        }
+        return *this;
+    }
+    ~EdgePool() noexcept {
+        for (uint32_t slot = nextAlive(0); slot != capacity(); slot = nextAlive(slot + 1)) {
+            value_traits::destroy(_allocator, data(slot));
+        }
+        block_allocator alloc(_allocator);
+        for (auto* block : _blocks) {
+            block_traits::deallocate(alloc, block, 1);
+        }
+    }
+
+    allocator_type get_allocator() const noexcept { // NOLINT
+        return allocator_type(_allocator);
+    }
+
+    void swap(EdgePool& rhs) noexcept {
+        CC_EXPECTS(_allocator == rhs._allocator);
+        _blocks.swap(rhs._blocks);
+        _alive.swap(rhs._alive);
+        _free.swap(rhs._free);
+        std::swap(_size, rhs._size);
+    }
+
+    // Iterators
+    iterator begin() noexcept {
+        return iterator(this, nextAlive(0));
+    }
+    iterator end() noexcept {
+        return iterator(this, capacity());
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator(this, nextAlive(0));
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(this, capacity());
+    }
+
+    // Capacity
+    bool empty() const noexcept {
+        return _size == 0;
+    }
+    size_type size() const noexcept {
+        return _size;
+    }
+    size_type capacity() const noexcept {
+        return static_cast<size_type>(_blocks.size()) * BLOCK_SIZE;
+    }
+    void reserve(size_type sz) {
+        while (capacity() < sz) {
+            addBlock();
+        }
+    }
+
+    // Modifiers, the position is ignored and kept for list compatibility.
+    // Free slots are reused first, so iteration follows slot order, not insertion order.
+    template <class... Args>
+    iterator emplace(const_iterator /*pos*/, Args&&... args) {
+        if (_free.empty()) {
+            addBlock();
+        }
+        const auto slot = _free.back();
+        value_traits::construct(_allocator, data(slot), std::forward<Args>(args)...);
+        _free.pop_back();
+        _alive[slot / BLOCK_SIZE] |= uint64_t(1) << (slot % BLOCK_SIZE);
+        ++_size;
+        return iterator(this, slot);
+    }
+    template <class... Args>
+    reference emplace_back(Args&&... args) { // NOLINT
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+    iterator erase(const_iterator pos) noexcept {
+        const auto slot = pos._slot;
+        CC_EXPECTS(alive(slot));
+        value_traits::destroy(_allocator, data(slot));
+        _alive[slot / BLOCK_SIZE] &= ~(uint64_t(1) << (slot % BLOCK_SIZE));
+        _free.emplace_back(slot); // reserved by addBlock
+        --_size;
+        return iterator(this, nextAlive(slot + 1));
+    }
+    void clear() noexcept {
+        for (uint32_t slot = nextAlive(0); slot != capacity(); slot = nextAlive(slot + 1)) {
+            value_traits::destroy(_allocator, data(slot));
+        }
+        std::fill(_alive.begin(), _alive.end(), 0);
+        _free.clear();
+        for (uint32_t slot = capacity(); slot-- != 0;) {
+            _free.emplace_back(slot);
+        }
+        _size = 0;
+    }
+
+private:
+    // slots of the copy are the slots of rhs, so the stored edges can be rebound by slot
+    template <class Pool>
+    void assign(Pool&& rhs) {
+        clear();
+        reserve(rhs.capacity());
+        for (uint32_t slot = rhs.nextAlive(0); slot != rhs.capacity(); slot = rhs.nextAlive(slot + 1)) {
+            if constexpr (std::is_lvalue_reference_v<Pool>) {
+                value_traits::construct(_allocator, data(slot), *rhs.data(slot));
+            } else {
+                value_traits::construct(_allocator, data(slot), std::move(*rhs.data(slot)));
+            }
+            _alive[slot / BLOCK_SIZE] |= uint64_t(1) << (slot % BLOCK_SIZE);
+        }
+        _free.clear();
+        for (uint32_t slot = capacity(); slot-- != 0;) {
+            if (!alive(slot)) {
+                _free.emplace_back(slot);
+            }
+        }
+        _size = rhs._size;
+    }
+    void addBlock() {
+        block_allocator alloc(_allocator);
+        _blocks.emplace_back(block_traits::allocate(alloc, 1));
+        _alive.emplace_back(0);
+        // every slot can be freed, so erase and clear never allocate
+        _free.reserve(capacity());
+        // lowest slot on top, so a new block fills in slot order
+        const auto first = capacity() - BLOCK_SIZE;
+        _free.insert(_free.begin(), BLOCK_SIZE, 0);
+        for (uint32_t i = 0; i != BLOCK_SIZE; ++i) {
+            _free[i] = first + BLOCK_SIZE - 1 - i;
+        }
+    }
+    bool alive(uint32_t slot) const noexcept {
+        return (_alive[slot / BLOCK_SIZE] >> (slot % BLOCK_SIZE)) & 1;
+    }
+    T* data(uint32_t slot) const noexcept {
+        auto* block = _blocks[slot / BLOCK_SIZE];
+        return std::launder(reinterpret_cast<T*>(block->storage) + slot % BLOCK_SIZE);
+    }
+    // first alive slot not before slot, capacity() if none
+    uint32_t nextAlive(uint32_t slot) const noexcept {
+        auto word = slot / BLOCK_SIZE;
+        if (word >= _alive.size()) {
+            return capacity();
+        }
+        auto bits = _alive[word] & (~uint64_t(0) << (slot % BLOCK_SIZE));
+        while (!bits) {
+            if (++word == _alive.size()) {
+                return capacity();
+            }
+            bits = _alive[word];
+        }
+        return word * BLOCK_SIZE + countTrailingZeros(bits);
+    }
+    // last alive slot not after slot, the slot must exist
+    uint32_t prevAlive(uint32_t slot) const noexcept {
+        auto word = slot / BLOCK_SIZE;
+        auto bits = _alive[word] & (~uint64_t(0) >> (BLOCK_SIZE - 1 - slot % BLOCK_SIZE));
+        while (!bits) {
+            CC_EXPECTS(word != 0);
+            bits = _alive[--word];
+        }
+        return word * BLOCK_SIZE + BLOCK_SIZE - 1 - countLeadingZeros(bits);
+    }
+
+    using block_pointer_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Block*>;
+    using word_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<uint64_t>;
+    using slot_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<uint32_t>;
+
+    boost::container::vector<Block*, block_pointer_allocator> _blocks;
+    boost::container::vector<uint64_t, word_allocator> _alive;
+    boost::container::vector<uint32_t, slot_allocator> _free;
+    uint32_t _size = 0;
+    value_allocator _allocator;
+};
+)";
+}
+
+void outputObjectRange(std::ostream& oss) {
+    oss << R"(
+// Objects of one polymorphic type paired with their vertices, in storage order.
+// The vertex list holds the vertex of each object, at the index of the object.
+template <class VertexDescriptor, class Object>
+class ObjectVertexIterator : public boost::iterator_facade<
+                                 ObjectVertexIterator<VertexDescriptor, Object>,
+                                 std::pair<VertexDescriptor, Object&>,
+                                 boost::random_access_traversal_tag,
+                                 std::pair<VertexDescriptor, Object&>> {
+public:
+    ObjectVertexIterator() = default;
+    ObjectVertexIterator(const VertexDescriptor* vertex, Object* object) noexcept
+    : _vertex(vertex), _object(object) {}
+
+private:
+    friend class boost::iterator_core_access;
+
+    std::pair<VertexDescriptor, Object&> dereference() const noexcept {
+        return {*_vertex, *_object};
+    }
+    bool equal(const ObjectVertexIterator& rhs) const noexcept {
+        return _object == rhs._object;
+    }
+    void increment() noexcept {
+        ++_vertex;
+        ++_object;
+    }
+    void decrement() noexcept {
+        --_vertex;
+        --_object;
+    }
+    void advance(std::ptrdiff_t n) noexcept {
+        _vertex += n;
+        _object += n;
+    }
+    std::ptrdiff_t distance_to(const ObjectVertexIterator& rhs) const noexcept {
+        return rhs._object - _object;
+    }
+
+    const VertexDescriptor* _vertex = nullptr;
+    Object* _object = nullptr;
+};
+
+template <class VertexList, class ObjectList>
+inline auto makeObjectRange(const VertexList& vertices, ObjectList& objects) noexcept {
+    using Object = std::remove_pointer_t<decltype(objects.data())>;
+    using Iterator = ObjectVertexIterator<typename VertexList::value_type, Object>;
+    CC_EXPECTS(vertices.size() == objects.size());
+    return boost::make_iterator_range(
+        Iterator(vertices.data(), objects.data()),
+        Iterator(vertices.data() + vertices.size(), objects.data() + objects.size()));
+}
+)";
+}
+
+void outputFrozenStringMap(std::ostream& oss) {
+    oss << R"(
+// String map that can be frozen once it is filled. While frozen, lookups binary search
+// the hashes of the keys, sorted next to their entries, instead of probing the buckets.
+// Any change thaws the map, and lookups fall back to the buckets until it is frozen again.
+template <class Map>
+class FrozenStringMap {
+public:
+    using key_type = typename Map::key_type;
+    using mapped_type = typename Map::mapped_type;
+    using value_type = typename Map::value_type;
+    using size_type = typename Map::size_type;
+    using iterator = typename Map::iterator;
+    using const_iterator = typename Map::const_iterator;
+    using allocator_type = typename Map::allocator_type;
+
+    FrozenStringMap() = default;
+    explicit FrozenStringMap(const allocator_type& alloc)
+    : _map(alloc), _entries(alloc) {}
+    FrozenStringMap(FrozenStringMap&& rhs, const allocator_type& alloc)
+    : _map(std::move(rhs._map), alloc), _entries(alloc) {
+        rhs.thaw();
+    }
+    FrozenStringMap(const FrozenStringMap& rhs, const allocator_type& alloc)
+    : _map(rhs._map, alloc), _entries(alloc) {}
+    // moving the map keeps its nodes, so the entries stay valid
+    FrozenStringMap(FrozenStringMap&& rhs) noexcept(std::is_nothrow_move_constructible_v<Map>)
+    : _map(std::move(rhs._map)), _entries(std::move(rhs._entries)), _frozen(rhs._frozen) {
+        rhs._frozen = false;
+    }
+    FrozenStringMap(const FrozenStringMap& rhs)
+    : _map(rhs._map), _entries(_map.get_allocator()) {}
+
+    FrozenStringMap& operator=(FrozenStringMap&& rhs) {
+        thaw();
+        _map = std::move(rhs._map);
+        rhs.thaw();
+        return *this;
+    }
+    FrozenStringMap& operator=(const FrozenStringMap& rhs) {
+        thaw();
+        _map = rhs._map;
+        return *this;
+    }
+    ~FrozenStringMap() = default;
+
+    allocator_type get_allocator() const noexcept {
+        return _map.get_allocator();
+    }
+
+    // call once the map is filled, the table is built again on each call
+    void freeze() {
+        thaw();
+        _entries.reserve(_map.size());
+        for (auto iter = _map.begin(); iter != _map.end(); ++iter) {
+            _entries.emplace_back(Entry{std::hash<view_type>{}(view_type(iter->first)), iter});
+        }
+        std::sort(_entries.begin(), _entries.end(), [](const Entry& lhs, const Entry& rhs) {
+            return lhs.hash < rhs.hash;
+        });
+        _frozen = true;
+    }
+    void thaw() noexcept {
+        _entries.clear();
+        _frozen = false;
+    }
+    bool frozen() const noexcept {
+        return _frozen;
+    }
+
+    // Lookups
+    template <class KeyLike>
+    iterator find(const KeyLike& key) {
+        if (!_frozen) {
+            return _map.find(key);
+        }
+        const auto* entry = search(view_type(key));
+        return entry ? entry->iter : _map.end();
+    }
+    template <class KeyLike>
+    const_iterator find(const KeyLike& key) const {
+        if (!_frozen) {
+            return _map.find(key);
+        }
+        const auto* entry = search(view_type(key));
+        return entry ? const_iterator(entry->iter) : _map.end();
+    }
+    template <class KeyLike>
+    size_type count(const KeyLike& key) const {
+        return find(key) == end() ? 0 : 1;
+    }
+    template <class KeyLike>
+    bool contains(const KeyLike& key) const {
+        return find(key) != end();
+    }
+    template <class KeyLike>
+    mapped_type& at(const KeyLike& key) {
+        auto iter = find(key);
+        if (iter == end()) {
+            throw std::out_of_range("at(FrozenStringMap) out of range");
+        }
+        return iter->second;
+    }
+    template <class KeyLike>
+    const mapped_type& at(const KeyLike& key) const {
+        auto iter = find(key);
+        if (iter == end()) {
+            throw std::out_of_range("at(FrozenStringMap) out of range");
+        }
+        return iter->second;
+    }
+
+    // Modifiers
+    template <class... Args>
+    std::pair<iterator, bool> emplace(Args&&... args) {
+        thaw();
+        return _map.emplace(std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    std::pair<iterator, bool> try_emplace(const key_type& key, Args&&... args) {
+        thaw();
+        return _map.try_emplace(key, std::forward<Args>(args)...);
+    }
+    template <class... Args>
+    std::pair<iterator, bool> try_emplace(key_type&& key, Args&&... args) {
+        thaw();
+        return _map.try_emplace(std::move(key), std::forward<Args>(args)...);
+    }
+    std::pair<iterator, bool> insert(const value_type& value) {
+        thaw();
+        return _map.insert(value);
+    }
+    std::pair<iterator, bool> insert(value_type&& value) {
+        thaw();
+        return _map.insert(std::move(value));
+    }
+    mapped_type& operator[](const key_type& key) {
+        thaw();
+        return _map[key];
+    }
+    mapped_type& operator[](key_type&& key) {
+        thaw();
+        return _map[std::move(key)];
+    }
+    iterator erase(const_iterator pos) {
+        thaw();
+        return _map.erase(pos);
+    }
+    size_type erase(const key_type& key) {
+        thaw();
+        return _map.erase(key);
+    }
+    void clear() noexcept {
+        thaw();
+        _map.clear();
+    }
+    void reserve(size_type n) {
+        thaw();
+        _map.reserve(n);
+    }
+
+    // Iterators
+    iterator begin() noexcept {
+        return _map.begin();
+    }
+    iterator end() noexcept {
+        return _map.end();
+    }
+    const_iterator begin() const noexcept {
+        return _map.begin();
+    }
+    const_iterator end() const noexcept {
+        return _map.end();
+    }
+    const_iterator cbegin() const noexcept {
+        return _map.cbegin();
+    }
+    const_iterator cend() const noexcept {
+        return _map.cend();
+    }
+    size_type size() const noexcept {
+        return _map.size();
+    }
+    bool empty() const noexcept {
+        return _map.empty();
+    }
+
+private:
+    using view_type = std::basic_string_view<typename key_type::value_type>;
+
+    struct Entry {
+        size_t hash;
+        iterator iter;
+    };
+
+    const Entry* search(view_type key) const noexcept {
+        const auto hash = std::hash<view_type>{}(key);
+        auto iter = std::lower_bound(_entries.begin(), _entries.end(), hash, [](const Entry& entry, size_t value) {
+            return entry.hash < value;
+        });
+        for (; iter != _entries.end() && iter->hash == hash; ++iter) {
+            if (view_type(iter->iter->first) == key) {
+                return &*iter;
+            }
+        }
+        return nullptr;
+    }
+
+    using entry_allocator = typename std::allocator_traits<allocator_type>::template rebind_alloc<Entry>;
+
+    Map _map;
+    boost::container::vector<Entry, entry_allocator> _entries;
+    bool _frozen = false;
+};
+)";
+}
+
+} // namespace
+
+std::pmr::string generateGraphSupport_h(std::pmr::memory_resource* scratch) {
+    CodeStream oss(scratch);
+
+    oss << R"(// clang-format off
+#pragma once
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <functional>
+#include <new>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <boost/container/pmr/polymorphic_allocator.hpp>
+#include <boost/container/vector.hpp>
+#include <boost/graph/two_bit_color_map.hpp>
+#include <boost/iterator/iterator_facade.hpp>
+#include <boost/property_map/property_map.hpp>
+#include <boost/range/iterator_range.hpp>
+#include "cocos/base/Macros.h"
+#include "cocos/base/std/container/vector.h"
+#include "cocos/renderer/pipeline/custom/details/Map.h"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+    #include <intrin.h>
+#endif
+
+namespace cc {
+
+namespace render {
+
+namespace impl {
+)";
+    outputPackedColors(oss);
+    outputEdgePool(oss);
+    outputObjectRange(oss);
+    outputFrozenStringMap(oss);
+    oss << R"(
+} // namespace impl
+
+} // namespace render
+
+// edge list of pmr graphs, see EdgePool
+template <class T>
+using PmrEdgePool = render::impl::EdgePool<T, boost::container::pmr::polymorphic_allocator<T>>;
+
+// string map of pmr graphs, see FrozenStringMap
+template <class Key, class Value>
+using PmrFrozenStringMap = render::impl::FrozenStringMap<PmrUnorderedStringMap<Key, Value>>;
+
+} // namespace cc
+
+// clang-format on
+)";
+    return oss.release();
+}
+
+} // namespace Cocos::Meta
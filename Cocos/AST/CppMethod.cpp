@@ -23,7 +23,7 @@ std::pmr::vector<std::pmr::string> splitFunctions(
 }
 
 void parseParameter(ModuleBuilder& builder, std::string_view& parameters, Parameter& param) {
-    auto scratch = builder.mScratch;
+    auto scratch = getThreadScratch(builder.mScratch);
     Ensures(!parameters.empty());
     Ensures(parameters.back() != ' ');
 
@@ -81,11 +81,11 @@ void parseParameter(ModuleBuilder& builder, std::string_view& parameters, Parame
 
     param.mTypePath = g.getTypePath(builder.mCurrentScope,
         typeName, scratch, scratch);
-    Expects(locate(param.mTypePath, g) != g.null_vertex());
+    Expects(locate(param, g) != g.null_vertex());
 }
 
 Parameter findLastParameter(ModuleBuilder& builder, std::string_view& parameters) {
-    auto scratch = builder.mScratch;
+    auto scratch = getThreadScratch(builder.mScratch);
     Parameter param(scratch);
 
     {
@@ -118,7 +118,7 @@ Parameter findLastParameter(ModuleBuilder& builder, std::string_view& parameters
 }
 
 Method parseFunction(ModuleBuilder& builder, std::string_view function) {
-    auto scratch = builder.mScratch;
+    auto scratch = getThreadScratch(builder.mScratch);
     Method method(scratch);
 
     if (boost::algorithm::contains(function, "[[skip]]")) {
@@ -250,7 +250,7 @@ Method parseFunction(ModuleBuilder& builder, std::string_view function) {
 }
 
 std::pmr::vector<Method> parseFunctions(ModuleBuilder& builder, std::string_view functions) {
-    auto scratch = builder.mScratch;
+    auto scratch = getThreadScratch(builder.mScratch);
     std::pmr::vector<Method> methods(scratch);
     auto cleaned = splitFunctions(functions, scratch);
 
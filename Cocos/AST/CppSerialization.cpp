@@ -38,7 +38,7 @@ std::pmr::string generateSerialization_h(
     bool nvp,
     std::pmr::memory_resource* mr,
     std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios_base::out, mr);
+    CodeStream oss(mr);
     std::pmr::string space(scratch);
     CodegenContext context(scratch);
 
@@ -56,12 +56,7 @@ std::pmr::string generateSerialization_h(
     oss << "namespace render {\n";
 
     int numTrival = 0;
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& moduleName = get(g.modulePaths, g, vertID);
-        if (moduleName != moduleName0) {
-            continue;
-        }
-
+    for (const auto& vertID : g.getModuleVertices(moduleName0)) {
         if (holds_tag<Define_>(vertID, g)) {
             continue;
         }
@@ -100,14 +95,14 @@ std::pmr::string generateSerialization_h(
                             if (m.mFlags & GenerationFlags::NO_SERIALIZATION)
                                 continue;
 
-                            auto memberID = locate(m.mTypePath, g);
+                            auto memberID = locate(m, g);
                             if ((m.mFlags & GenerationFlags::NO_SERIALIZATION)
                                 || (m.mFlags & GenerationFlags::IMPL_DETAIL)) {
                                 continue;
                             }
                             if (g.isTypescriptPointer(memberID)) {
                                 OSS << "// skip, " << m.getMemberName() << ": "
-                                    << g.getDependentCppName(ns, memberID, scratch, scratch) << "\n";
+                                    << g.getCachedDependentCppName(ns, memberID, scratch) << "\n";
                                 continue;
                             }
                             OSS << "save(ar, v." << m.getMemberName() << ");\n";
@@ -126,14 +121,14 @@ std::pmr::string generateSerialization_h(
                             if (m.mFlags & GenerationFlags::NO_SERIALIZATION)
                                 continue;
 
-                            auto memberID = locate(m.mTypePath, g);
+                            auto memberID = locate(m, g);
                             if ((m.mFlags & GenerationFlags::NO_SERIALIZATION)
                                 || (m.mFlags & GenerationFlags::IMPL_DETAIL)) {
                                 continue;
                             }
                             if (g.isTypescriptPointer(memberID)) {
                                 OSS << "// skip, " << m.getMemberName() << ": "
-                                    << g.getDependentCppName(ns, memberID, scratch, scratch) << "\n";
+                                    << g.getCachedDependentCppName(ns, memberID, scratch) << "\n";
                                 continue;
                             }
                             OSS << "load(ar, v." << m.getMemberName() << ");\n";
@@ -157,7 +152,7 @@ std::pmr::string generateSerialization_h(
     oss << "\n";
     oss << "} // namespace cc\n";
 
-    return oss.str();
+    return oss.release();
 }
 
 }
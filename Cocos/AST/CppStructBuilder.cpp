@@ -117,7 +117,7 @@ std::pmr::string CppStructBuilder::getImplName(std::string_view ns) const {
 }
 
 std::pmr::string CppStructBuilder::generateGetAllocatorSignature(bool bInline) const {
-    pmr_ostringstream oss(std::ios_base::out, get_allocator());
+    CodeStream oss(get_allocator());
     if (!bInline) {
         oss << mName << "::";
     }
@@ -127,11 +127,11 @@ std::pmr::string CppStructBuilder::generateGetAllocatorSignature(bool bInline) c
     }
     oss << "get_allocator() const noexcept";
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppStructBuilder::generateGetAllocatorBody() const {
-    pmr_ostringstream oss(std::ios_base::out, get_allocator());
+    CodeStream oss(get_allocator());
     std::pmr::string space(get_allocator());
 
     const auto& g = *mSyntaxGraph;
@@ -140,7 +140,7 @@ std::pmr::string CppStructBuilder::generateGetAllocatorBody() const {
         [&](const Composition_ auto& s) {
             bool found = false;
             for (const auto& m : s.mMembers) {
-                auto vertID = locate(m.mTypePath, g);
+                auto vertID = locate(m, g);
                 if (g.isOptional(vertID)) {
                     continue;
                 }
@@ -156,7 +156,7 @@ std::pmr::string CppStructBuilder::generateGetAllocatorBody() const {
         [&](const auto&) {
         });
 
-    return oss.str();
+    return oss.release();
 }
 
 namespace {
@@ -213,7 +213,7 @@ void outputMembers(std::ostream& oss, std::pmr::string& space,
 
     uint32_t start = 0;
     for (int i = 0; const Member& m : s.mMembers) {
-        auto memberID = locate(m.mTypePath, g);
+        auto memberID = locate(m, g);
         const auto& traits = get(g.traits, g, memberID);
         if (traits.mUnknown) {
             outputFormatted();
@@ -242,7 +242,7 @@ void outputMembers(std::ostream& oss, std::pmr::string& space,
 
         auto& content = f.mMembers.emplace_back();
         {
-            pmr_ostringstream oss(std::ios::out, scratch);
+            CodeStream oss(scratch);
             auto name = g.getDependentName(ns, memberID, scratch, scratch);
             if (name.empty()) {
                 // if dependent name is empty, the scope is the same of input type
@@ -279,9 +279,9 @@ void outputMembers(std::ostream& oss, std::pmr::string& space,
                 content.mDefaultValue = m.mDefaultValue;
             } else {
                 if (holds_tag<Enum_>(memberID, g)) {
-                    pmr_ostringstream oss(std::ios::out, scratch);
+                    CodeStream oss(scratch);
                     const auto& e = get<Enum>(memberID, g);
-                    const auto enumType = g.getDependentCppName(ns, memberID, scratch, scratch);
+                    const auto enumType = g.getCachedDependentCppName(ns, memberID, scratch);
                     Expects(!e.mValues.empty());
                     oss << enumType << "::" << e.mValues.front().mName;
                     content.mDefaultValue = oss.str();
@@ -297,7 +297,7 @@ void outputMembers(std::ostream& oss, std::pmr::string& space,
 
 std::pmr::string CppStructBuilder::generateMembers() const {
     auto scratch = get_allocator().resource();
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
     const auto& g = *mSyntaxGraph;
     auto scope = g.getScope(mCurrentVertex, scratch);
@@ -310,12 +310,12 @@ std::pmr::string CppStructBuilder::generateMembers() const {
             Expects(false);
         });
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppStructBuilder::generateOperatorSignature(OperatorType type, bool bInline) const {
     auto scratch = get_allocator().resource();
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
     const auto& g = *mSyntaxGraph;
 
@@ -396,12 +396,12 @@ std::pmr::string CppStructBuilder::generateOperatorSignature(OperatorType type,
         throw std::invalid_argument("unknown OperatorType case");
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppStructBuilder::generateOperatorBody(OperatorType type) const {
     auto scratch = get_allocator().resource();
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
     const auto& g = *mSyntaxGraph;
 
@@ -418,7 +418,7 @@ std::pmr::string CppStructBuilder::generateOperatorBody(OperatorType type) const
     }
     case OperatorType::Unequal: {
         OSS << "return !(lhs == rhs);\n";
-        return oss.str();
+        return oss.release();
     }
     case OperatorType::Less: {
         op = "<";
@@ -464,7 +464,7 @@ std::pmr::string CppStructBuilder::generateOperatorBody(OperatorType type) const
             // do nothing
         });
 
-    return oss.str();
+    return oss.release();
 }
 
 namespace {
@@ -483,8 +483,8 @@ void generateCntr(std::ostream& oss, std::pmr::string& space,
     if (!baseCntrs.empty()) {
         for (const auto& baseCntr : baseCntrs) {
             const auto baseID = baseCntr.mBaseID;
-            const auto baseName = g.getDependentCppName(
-                cpp.mCurrentNamespace, baseID, scratch, scratch);
+            const auto baseName = g.getCachedDependentCppName(
+                cpp.mCurrentNamespace, baseID, scratch);
             bool bPmr = g.isPmr(baseID);
             if (count++) {
                 oss << "\n";
@@ -496,7 +496,7 @@ void generateCntr(std::ostream& oss, std::pmr::string& space,
             {
                 int count = 0;
                 for (const auto& param : baseCntr.mParameters) {
-                    const auto paramID = locate(param.mTypePath, g);
+                    const auto paramID = locate(param, g);
                     const auto& paramTraits = get(g.traits, g, paramID);
                     if (count++) {
                         oss << ", ";
@@ -523,7 +523,7 @@ void generateCntr(std::ostream& oss, std::pmr::string& space,
     }
 
     for (uint32_t i = 0; const auto& m : s.mMembers) {
-        auto memberID = locate(m.mTypePath, g);
+        auto memberID = locate(m, g);
         const auto& memberTraits = get(g.traits, g, memberID);
         bool bPmr = g.isPmr(memberID);
         bool bCopyParam = false;
@@ -596,7 +596,7 @@ void generateMove(std::ostream& oss, std::pmr::string& space,
     int count = 0;
     const auto optionalID = locate("/std/optional", g);
     for (const auto& m : s.mMembers) {
-        auto memberID = locate(m.mTypePath, g);
+        auto memberID = locate(m, g);
         const auto& memberTraits = get(g.traits, g, memberID);
         bool bPmr = g.isPmr(memberID);
         if (m.mReference || m.mPointer)
@@ -664,7 +664,7 @@ void generateCopy(std::ostream& oss, std::pmr::string& space,
     int count = 0;
     const auto optionalID = locate("/std/optional", g);
     for (const auto& m : s.mMembers) {
-        auto memberID = locate(m.mTypePath, g);
+        auto memberID = locate(m, g);
         bool bPmr = g.isPmr(memberID);
         if (m.mReference || m.mPointer)
             bPmr = false;
@@ -712,7 +712,7 @@ void generateMoveAssign(std::ostream& oss, std::pmr::string& space,
     OSS << "const auto alloc = get_allocator();\n";
     const auto optionalID = locate("/std/optional", g);
     for (const auto& m : s.mMembers) {
-        auto memberID = locate(m.mTypePath, g);
+        auto memberID = locate(m, g);
         bool bPmr = g.isPmr(memberID);
         if (m.mReference || m.mPointer)
             bPmr = false;
@@ -748,7 +748,7 @@ void generateCopyAssign(std::ostream& oss, std::pmr::string& space,
     OSS << "const auto alloc = get_allocator();\n";
     const auto optionalID = locate("/std/optional", g);
     for (const auto& m : s.mMembers) {
-        auto memberID = locate(m.mTypePath, g);
+        auto memberID = locate(m, g);
         bool bPmr = g.isPmr(memberID);
         if (m.mReference || m.mPointer)
             bPmr = false;
@@ -780,7 +780,7 @@ void generateCopyAssign(std::ostream& oss, std::pmr::string& space,
 
 std::pmr::string CppStructBuilder::generateHeaderConstructors() const {
     auto scratch = get_allocator().resource();
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
     const auto& g = *mSyntaxGraph;
 
@@ -1112,12 +1112,12 @@ std::pmr::string CppStructBuilder::generateHeaderConstructors() const {
         [&](const auto&) {
         });
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppStructBuilder::generateCppConstructors() const {
     auto scratch = get_allocator().resource();
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
     const auto& g = *mSyntaxGraph;
 
@@ -1260,13 +1260,13 @@ std::pmr::string CppStructBuilder::generateCppConstructors() const {
         [&](const auto&) {
         });
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppStructBuilder::generateConstructorSignature(
     const Constructor& cntr, bool bInline) const {
     auto scratch = get_allocator().resource();
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
     const auto& g = *mSyntaxGraph;
 
@@ -1289,7 +1289,7 @@ std::pmr::string CppStructBuilder::generateConstructorSignature(
             if (count++)
                 oss << ", ";
             const auto& m = s.mMembers.at(k);
-            auto memberID = locate(m.mTypePath, g);
+            auto memberID = locate(m, g);
             if (m.mTypePath == "/std/pmr/string") {
                 bNoexcept = false;
                 oss << "std::string_view " << getParameterName(m.mMemberName, scratch);
@@ -1320,7 +1320,7 @@ std::pmr::string CppStructBuilder::generateConstructorSignature(
             for (const auto& baseCntr : baseCntrs) {
                 const auto baseID = baseCntr.mBaseID;
                 for (const auto& param : baseCntr.mParameters) {
-                    const auto paramID = locate(param.mTypePath, g);
+                    const auto paramID = locate(param, g);
                     auto name = g.getDependentName(mCurrentNamespace, paramID, scratch, scratch);
 
                     if (count++) {
@@ -1365,12 +1365,12 @@ std::pmr::string CppStructBuilder::generateConstructorSignature(
         oss << " noexcept";
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppStructBuilder::generateConstructorBody(const Constructor& cntr) const {
     auto scratch = get_allocator().resource();
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
     const auto& g = *mSyntaxGraph;
 
@@ -1378,13 +1378,13 @@ std::pmr::string CppStructBuilder::generateConstructorBody(const Constructor& cn
     auto name = get(g.names, g, vertID);
     const auto& traits = get(g.traits, g, vertID);
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppStructBuilder::generateConstructorCall(
     SyntaxGraph::vertex_descriptor vertID, const Constructor& cntr) const {
     auto scratch = get_allocator().resource();
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
     const auto& g = *mSyntaxGraph;
 
@@ -1399,7 +1399,7 @@ std::pmr::string CppStructBuilder::generateConstructorCall(
                 if (count++)
                     oss << ", ";
                 const auto& m = s.mMembers.at(k);
-                auto memberID = locate(m.mTypePath, g);
+                auto memberID = locate(m, g);
                 const auto& memberTraits = get(g.traits, g, memberID);
                 if (m.mTypePath == "/std/pmr/string") {
                     oss << "std::move(" << getParameterName(m.mMemberName, scratch) << ")";
@@ -1434,12 +1434,12 @@ std::pmr::string CppStructBuilder::generateConstructorCall(
         });
 
     oss << ")";
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string CppStructBuilder::generateMemberFunctions(std::pmr::string& space) const {
     auto scratch = get_allocator().resource();
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
 
     const auto& g = *mSyntaxGraph;
     const auto vertID = mCurrentVertex;
@@ -1462,7 +1462,7 @@ std::pmr::string CppStructBuilder::generateMemberFunctions(std::pmr::string& spa
         [&](const auto&) {
         });
 
-    return oss.str();
+    return oss.release();
 }
 
 namespace {
@@ -1488,7 +1488,7 @@ void outputParam(const CppStructBuilder& builder, std::ostream& oss, const Param
 
 std::pmr::string CppStructBuilder::generateDispatchMethods(const Method& m) const {
     auto scratch = get_allocator().resource();
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     const auto& g = *mSyntaxGraph;
@@ -1533,7 +1533,7 @@ std::pmr::string CppStructBuilder::generateDispatchMethods(const Method& m) cons
                 if (count++) {
                     oss << ", ";
                 }
-                auto paramID = locate(param.mTypePath, g);
+                auto paramID = locate(param, g);
                 Expects(m.mParameters.size() >= i + 1);
                 uint32_t start = static_cast<uint32_t>(m.mParameters.size()) - i - 1;
                 if (count > start) {
@@ -1550,7 +1550,7 @@ std::pmr::string CppStructBuilder::generateDispatchMethods(const Method& m) cons
         }
         OSS << "}\n";
     }
-    return oss.str();
+    return oss.release();
 }
 
 void CppStructBuilder::generateMethod(
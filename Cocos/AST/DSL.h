@@ -26,6 +26,7 @@ THE SOFTWARE.
 
 #pragma once
 #pragma warning(disable : 4390)
+#include <Cocos/AST/Profiler.h>
 
 // clang-format off
 
@@ -246,6 +247,12 @@ builder.addMember(vertID, COND,\
 #define OBJECT_DESCRIPTOR() \
     graph.mVertexListType = List_ {}
 
+#define SLOT_MAP() \
+    graph.mVertexListType = SlotMap_ {}
+
+#define SMALL_EDGE_LIST(N) \
+    graph.mOutEdgeListType = SmallVector_ { N }
+
 #define NAMED_GRAPH(...)                               \
     builder.addNamedConcept(vertID, true, \
         BOOST_PP_SEQ_FOR_EACH_I(COMMA_STRINGIZE_ELEM, _, BOOST_PP_TUPLE_TO_SEQ((__VA_ARGS__))))
@@ -277,11 +284,36 @@ BOOST_PP_SEQ_FOR_EACH_I(POLYMORPHIC_GRAPH_ELEM, _, BOOST_PP_VARIADIC_SEQ_TO_SEQ(
     graph.mReferenceGraph = true; \
     graph.mAliasGraph = true
 
+// vector graphs with a color map also emit packed colors and visited bitsets by default
+#define NO_PACKED_COLOR_MAP() \
+    graph.mPackedColorMap = false
+
+#define CSR_FREEZE() \
+    graph.mCsrFreeze = true
+
+#define FRAGMENT_GRAPH() \
+    graph.mFragment = true
+
+#define ORDERED_DAG_GRAPH() \
+    graph.mOrderedDag = true
+
+#define OBJECT_RANGES() \
+    graph.mObjectRanges = true
+
+#define LEVEL_GRAPH() \
+    graph.mLevels = true
+
+#define DESCRIPTOR_TYPE(TYPE) \
+    graph.mVertexDescriptor = BOOST_PP_STRINGIZE(TYPE)
+
 #define ADDRESSABLE_GRAPH(MEMBER) \
     graph.mReferenceGraph = true; \
     graph.mAddressable = true; \
     graph.mAddressableConcept.mMemberName = BOOST_PP_STRINGIZE(MEMBER)
 
+#define PATH_TRIE() \
+    graph.mAddressableConcept.mType = Trie_ {}
+
 #define COMPONENT_BIMAP(MAPTYPE, MEMBER, ...) \
     builder.addVertexBimap(vertID,\
         BOOST_PP_STRINGIZE(MAPTYPE), BOOST_PP_STRINGIZE(MEMBER), \
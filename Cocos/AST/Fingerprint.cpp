@@ -0,0 +1,442 @@
+#include "Fingerprint.h"
+#include "BuilderTypes.h"
+#include "SyntaxGraphs.h"
+
+namespace Cocos::Meta {
+
+namespace {
+
+// Bump when the layout of the fingerprint file changes.
+// Emitter changes are covered by the build id of the generator.
+constexpr uint64_t sFingerprintVersion = 10;
+
+// FNV-1a, stable across runs and platforms
+struct Hasher {
+    void combine(std::string_view str) noexcept {
+        for (const char c : str) {
+            mValue ^= static_cast<uint8_t>(c);
+            mValue *= 1099511628211ull;
+        }
+        combine(static_cast<uint64_t>(str.size()));
+    }
+    void combine(uint64_t value) noexcept {
+        for (int i = 0; i != 8; ++i) {
+            mValue ^= (value >> (i * 8)) & 0xFF;
+            mValue *= 1099511628211ull;
+        }
+    }
+    void combine(bool value) noexcept {
+        combine(static_cast<uint64_t>(value));
+    }
+    void combine(uint32_t value) noexcept {
+        combine(static_cast<uint64_t>(value));
+    }
+    template <class T>
+    void combine(const std::pmr::vector<T>& values) {
+        combine(static_cast<uint64_t>(values.size()));
+        for (const auto& v : values) {
+            combine(v);
+        }
+    }
+    void combine(const std::pmr::string& str) noexcept {
+        combine(std::string_view(str));
+    }
+    void combine(const std::string& str) noexcept {
+        combine(std::string_view(str));
+    }
+    void combine(const Member& m) noexcept {
+        combine(m.mTypePath);
+        combine(m.mMemberName);
+        combine(m.mDefaultValue);
+        combine(m.mComments);
+        combine(m.mConst);
+        combine(m.mPointer);
+        combine(m.mReference);
+        combine(m.mPublic);
+        combine(static_cast<uint64_t>(m.mFlags));
+        combine(m.mTypescriptType);
+        combine(m.mTypescriptDefaultValue);
+        combine(m.mTypescriptArray);
+        combine(m.mTypescriptOptional);
+    }
+    void combine(const Parameter& p) noexcept {
+        combine(p.mTypePath);
+        combine(p.mName);
+        combine(p.mDefaultValue);
+        combine(p.mComment);
+        combine(p.mConst);
+        combine(p.mPointer);
+        combine(p.mReference);
+        combine(p.mRvalue);
+        combine(p.mOptional);
+    }
+    void combine(const Method& m) {
+        combine(m.mReturnType);
+        combine(m.mFunctionName);
+        combine(m.mParameters);
+        combine(m.mComment);
+        combine(m.mVirtual);
+        combine(m.mConst);
+        combine(m.mNoexcept);
+        combine(m.mPure);
+        combine(m.mStatic);
+        combine(m.mGetter);
+        combine(m.mSetter);
+        combine(m.mOptional);
+        combine(m.mSkip);
+        combine(m.mCovariant);
+        combine(static_cast<uint64_t>(m.mFlags));
+    }
+    void combine(const Constructor& c) {
+        combine(c.mIndices);
+        combine(c.mHasDefault);
+    }
+    void combine(const EnumValue& v) noexcept {
+        combine(v.mName);
+        combine(v.mValue);
+        combine(v.mReflectionName);
+        combine(v.mComment);
+        combine(v.mExport);
+        combine(v.mAlias);
+    }
+    void combine(const Base& base) noexcept {
+        combine(base.mTypePath);
+        combine(base.mVirtualBase);
+        combine(base.mImplements);
+    }
+    void combine(const PolymorphicPair& pair) noexcept {
+        combine(pair.mTag);
+        combine(pair.mValue);
+        combine(pair.mMemberName);
+        combine(pair.mContainerPath);
+        combine(pair.mVector);
+    }
+    void combine(const Component& c) noexcept {
+        combine(c.mName);
+        combine(c.mValuePath);
+        combine(c.mMemberName);
+        combine(c.mContainerPath);
+        combine(c.mVector);
+    }
+    void combine(const VertexMap& map) noexcept {
+        combine(map.mMapType);
+        combine(map.mMemberName);
+        combine(map.mKeyType);
+        combine(map.mComponentName);
+        combine(map.mComponentMemberName);
+        combine(map.mTypePath);
+    }
+    void combine(const Graph& s) {
+        combine(s.mMembers);
+        combine(s.mConstructors);
+        combine(s.mMemberFunctions);
+        combine(s.mMethods);
+        combine(s.mVertexProperty);
+        combine(s.mEdgeProperty);
+        combine(s.mComponents);
+        combine(s.mIncidence);
+        combine(s.mAdjacency);
+        combine(s.mUndirected);
+        combine(s.mBidirectional);
+        combine(s.mVertexList);
+        combine(s.mEdgeList);
+        combine(s.mMutableGraphVertex);
+        combine(s.mMutableGraphEdge);
+        combine(s.mNamed);
+        combine(s.mReferenceGraph);
+        combine(s.mAliasGraph);
+        combine(s.mAddressable);
+        combine(s.mAddressIndex);
+        combine(s.mMutableReference);
+        combine(s.mColorMap);
+        combine(s.mPackedColorMap);
+        combine(s.mCsrFreeze);
+        combine(s.mFragment);
+        combine(s.mOrderedDag);
+        combine(s.mObjectRanges);
+        combine(s.mLevels);
+        combine(s.mPolymorphic.mConcepts);
+        combine(static_cast<uint64_t>(s.mVertexListType.index()));
+        combine(static_cast<uint64_t>(s.mEdgeListType.index()));
+        combine(static_cast<uint64_t>(s.mOutEdgeListType.index()));
+        if (s.hasSmallEdgeList()) {
+            combine(s.getSmallEdgeListCapacity());
+        }
+        combine(s.mVertexListPath);
+        combine(s.mEdgeListPath);
+        combine(s.mOutEdgeListPath);
+        combine(s.mVertexDescriptor);
+        combine(s.mVertexSizeType);
+        combine(s.mDifferenceType);
+        combine(s.mEdgeSizeType);
+        combine(s.mEdgeDifferenceType);
+        combine(s.mDegreeSizeType);
+        combine(s.mVertexMaps);
+        combine(s.mNamedConcept.mComponent);
+        combine(s.mNamedConcept.mComponentName);
+        combine(s.mNamedConcept.mComponentMemberName);
+        combine(s.mAddressableConcept.mUtf8);
+        combine(s.mAddressableConcept.mPathPropertyMap);
+        combine(static_cast<uint64_t>(s.mAddressableConcept.mType.index()));
+        combine(s.mAddressableConcept.mMemberName);
+        combine(s.mTypescriptMembers);
+        combine(s.mTypescriptFunctions);
+    }
+
+    uint64_t mValue = 14695981039346656037ull;
+};
+
+void hashVertex(Hasher& h, SyntaxGraph::vertex_descriptor vertID,
+    const SyntaxGraph& g, std::pmr::memory_resource* scratch) {
+    h.combine(get_path(vertID, g, scratch));
+    h.combine(static_cast<uint64_t>(tag(vertID, g).index()));
+
+    const auto& traits = get(g.traits, g, vertID);
+    h.combine(traits.mClass);
+    h.combine(traits.mImport);
+    h.combine(traits.mExport);
+    h.combine(traits.mInterface);
+    h.combine(traits.mPmr);
+    h.combine(traits.mNoexcept);
+    h.combine(traits.mUnknown);
+    h.combine(traits.mTrivial);
+    h.combine(traits.mFinal);
+    h.combine(static_cast<uint64_t>(traits.mFlags));
+    h.combine(traits.mAlignment);
+
+    h.combine(get(g.constraints, g, vertID).mConcepts);
+    h.combine(get(g.inherits, g, vertID).mBases);
+
+    const auto& ts = get(g.typescripts, g, vertID);
+    h.combine(ts.mName);
+    h.combine(ts.mArray);
+
+    const auto& comment = get(g.comments, g, vertID);
+    h.combine(comment.mComment);
+    h.combine(static_cast<uint64_t>(comment.mParameterComments.size()));
+    for (const auto& [name, content] : comment.mParameterComments) {
+        h.combine(name);
+        h.combine(content);
+    }
+
+    visit_vertex(
+        vertID, g,
+        [&](const Define& d) {
+            h.combine(d.mContent);
+        },
+        [&](const Concept& c) {
+            h.combine(c.mParentPath);
+        },
+        [&](const Alias& a) {
+            h.combine(a.mTypePath);
+        },
+        [&](const Enum& e) {
+            h.combine(e.mIsFlags);
+            h.combine(e.mEnumOperator);
+            h.combine(e.mHasName);
+            h.combine(e.mUnderlyingType);
+            h.combine(e.mValues);
+        },
+        [&](const Tag& t) {
+            h.combine(t.mEntity);
+        },
+        [&](const Struct& s) {
+            h.combine(s.mMembers);
+            h.combine(s.mConstructors);
+            h.combine(s.mMemberFunctions);
+            h.combine(s.mTypescriptMembers);
+            h.combine(s.mTypescriptFunctions);
+            h.combine(s.mMethods);
+        },
+        [&](const Graph& s) {
+            h.combine(s);
+        },
+        [&](const Variant& v) {
+            h.combine(v.mVariants);
+            h.combine(v.mUseIndex);
+        },
+        [&](const Instance& inst) {
+            h.combine(inst.mTemplate);
+            h.combine(inst.mParameters);
+        },
+        [&](const auto&) {
+        });
+}
+
+uint64_t hashTypes(std::string_view modulePath, const SyntaxGraph& g,
+    std::pmr::memory_resource* scratch) {
+    Hasher h;
+    for (const auto& vertID : g.getModuleVertices(modulePath)) {
+        hashVertex(h, vertID, g, scratch);
+    }
+    return h.mValue;
+}
+
+uint64_t getModuleFingerprint(const ModuleBuilder& builder,
+    ModuleGraph::vertex_descriptor moduleID, uint64_t globalTypes,
+    std::pmr::vector<std::optional<uint64_t>>& fingerprints,
+    std::pmr::memory_resource* scratch) {
+    auto& fingerprint = fingerprints[moduleID];
+    if (fingerprint) {
+        return *fingerprint;
+    }
+
+    const auto& g = builder.mSyntaxGraph;
+    const auto& mg = builder.mModuleGraph;
+    const auto& m = get(mg.modules, mg, moduleID);
+    const auto modulePath = get_path(moduleID, mg, scratch);
+
+    Hasher h;
+    h.combine(getGeneratorBuildID());
+    h.combine(globalTypes);
+    h.combine(builder.mProjectName);
+    h.combine(builder.mUnderscoreMemberName);
+    h.combine(builder.mBoost);
+
+    h.combine(modulePath);
+    h.combine(static_cast<uint64_t>(m.mFeatures));
+    h.combine(m.mFolder);
+    h.combine(m.mFilePrefix);
+    h.combine(m.mJsbHeaders);
+    h.combine(m.mToJsFilename);
+    h.combine(m.mToJsPrefix);
+    h.combine(m.mToJsNamespace);
+    h.combine(m.mToJsHppHeaders);
+    h.combine(m.mToJsCppHeaders);
+    h.combine(m.mToJsUsingNamespace);
+    h.combine(m.mToJsConfigs);
+    h.combine(m.mTypescriptFolder);
+    h.combine(m.mTypescriptFilePrefix);
+    h.combine(m.mAPI);
+    h.combine(m.mHeader);
+    h.combine(m.mTypescriptInclude);
+    h.combine(m.mTail);
+    h.combine(hashTypes(modulePath, g, scratch));
+
+    h.combine(static_cast<uint64_t>(m.mRequires.size()));
+    for (const auto& require : m.mRequires) {
+        h.combine(require);
+        const auto requireID = locate(mg.null_vertex(), require, mg);
+        Expects(requireID != mg.null_vertex());
+        h.combine(getModuleFingerprint(builder, requireID, globalTypes, fingerprints, scratch));
+    }
+
+    fingerprint = h.mValue;
+    return h.mValue;
+}
+
+} // namespace
+
+std::filesystem::path getGeneratorPath() {
+#ifdef _WIN32
+    std::wstring path(MAX_PATH, L'\0');
+    for (;;) {
+        const auto sz = GetModuleFileNameW(nullptr, path.data(), static_cast<DWORD>(path.size()));
+        if (sz == 0) {
+            return {};
+        }
+        if (sz < path.size()) {
+            path.resize(sz);
+            return path;
+        }
+        path.resize(path.size() * 2);
+    }
+#else
+    std::error_code ec;
+    auto path = std::filesystem::read_symlink("/proc/self/exe", ec);
+    if (ec) {
+        return {};
+    }
+    return path;
+#endif
+}
+
+uint64_t getGeneratorBuildID() {
+    static const uint64_t sBuildID = []() -> uint64_t {
+        const auto path = getGeneratorPath();
+        if (path.empty()) {
+            return 0;
+        }
+        const auto content = readBinary(path, false);
+        if (content.empty()) {
+            return 0;
+        }
+        Hasher h;
+        h.combine(content);
+        return h.mValue;
+    }();
+    return sBuildID;
+}
+
+uint64_t hashOutputFiles(std::span<const std::filesystem::path> files) {
+    Hasher h;
+    for (const auto& file : files) {
+        std::error_code ec;
+        if (!std::filesystem::is_regular_file(file, ec)) {
+            return 0;
+        }
+        h.combine(file.generic_string());
+        h.combine(readBinary(file, false));
+    }
+    // 0 is reserved for missing files
+    return h.mValue ? h.mValue : 1;
+}
+
+PmrMap<std::pmr::string, ModuleFingerprint> getModuleFingerprints(
+    const ModuleBuilder& builder, std::pmr::memory_resource* mr) {
+    const auto& g = builder.mSyntaxGraph;
+    const auto& mg = builder.mModuleGraph;
+    auto scratch = builder.mScratch;
+
+    // types without module, such as the registered c++/stl types
+    const auto globalTypes = hashTypes("", g, scratch);
+
+    PmrMap<std::pmr::string, ModuleFingerprint> results(mr);
+    std::pmr::vector<std::optional<uint64_t>> fingerprints(num_vertices(mg), scratch);
+    for (const auto& moduleID : make_range(vertices(mg))) {
+        const auto& m = get(mg.modules, mg, moduleID);
+        auto& result = results[get_path(moduleID, mg, scratch)];
+        result.mFeatures = m.mFeatures;
+        result.mFingerprint = getModuleFingerprint(builder, moduleID, globalTypes, fingerprints, scratch);
+    }
+    return results;
+}
+
+PmrMap<std::pmr::string, ModuleFingerprint> readFingerprints(
+    const std::filesystem::path& filename, std::pmr::memory_resource* mr) {
+    PmrMap<std::pmr::string, ModuleFingerprint> results(mr);
+
+    std::istringstream iss(readFile(filename, false));
+    std::string header;
+    uint64_t version = 0;
+    if (!(iss >> header >> version) || header != "version" || version != sFingerprintVersion) {
+        return results;
+    }
+    std::string modulePath;
+    uint32_t features = 0;
+    uint64_t fingerprint = 0;
+    uint64_t outputs = 0;
+    while (iss >> modulePath >> std::hex >> features >> fingerprint >> outputs >> std::dec) {
+        auto& result = results[std::pmr::string(modulePath, mr)];
+        result.mFeatures = static_cast<Features>(features);
+        result.mFingerprint = fingerprint;
+        result.mOutputs = outputs;
+    }
+    return results;
+}
+
+void writeFingerprints(const std::filesystem::path& filename,
+    const PmrMap<std::pmr::string, ModuleFingerprint>& fingerprints) {
+    std::ostringstream oss;
+    oss << "version " << sFingerprintVersion << "\n";
+    oss << std::hex;
+    for (const auto& [modulePath, fingerprint] : fingerprints) {
+        oss << modulePath << " "
+            << static_cast<uint32_t>(fingerprint.mFeatures) << " "
+            << fingerprint.mFingerprint << " "
+            << fingerprint.mOutputs << "\n";
+    }
+    updateFile(filename, oss.str());
+}
+
+} // namespace Cocos::Meta
@@ -0,0 +1,34 @@
+#pragma once
+#include <Cocos/AST/BuilderFwd.h>
+
+namespace Cocos::Meta {
+
+struct ModuleFingerprint {
+    Features mFeatures = {};
+    uint64_t mFingerprint = 0;
+    // content of the files written for the module, 0 if one of them is missing
+    uint64_t mOutputs = 0;
+};
+
+// Path of the running generator executable, empty if unknown.
+std::filesystem::path getGeneratorPath();
+
+// Hash of the generator executable, so that every rebuild of the emitters
+// invalidates the fingerprints. 0 if the executable cannot be read.
+uint64_t getGeneratorBuildID();
+
+// Hash of the files as they are on disk, 0 if one of them is missing.
+uint64_t hashOutputFiles(std::span<const std::filesystem::path> files);
+
+// Structural hash of every module, keyed by module path.
+// A module's fingerprint covers its types, the modules it requires and the global types.
+PmrMap<std::pmr::string, ModuleFingerprint> getModuleFingerprints(
+    const ModuleBuilder& builder, std::pmr::memory_resource* mr);
+
+PmrMap<std::pmr::string, ModuleFingerprint> readFingerprints(
+    const std::filesystem::path& filename, std::pmr::memory_resource* mr);
+
+void writeFingerprints(const std::filesystem::path& filename,
+    const PmrMap<std::pmr::string, ModuleFingerprint>& fingerprints);
+
+} // namespace Cocos::Meta
@@ -1,25 +1,22 @@
 #include "JsbBuilder.h"
 #include "BuilderTypes.h"
 #include "SyntaxGraphs.h"
+#include "SyntaxUtils.h"
 
 namespace Cocos::Meta {
 
 std::pmr::string generateJsbConversions_h(const ModuleBuilder& builder, uint32_t moduleID) {
-    auto scratch = builder.mScratch;
-    pmr_ostringstream oss(std::ios::out, scratch);
+    auto scratch = getThreadScratch(builder.mScratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     const auto& g = builder.mSyntaxGraph;
     const auto& mg = builder.mModuleGraph;
+    const auto modulePath = get_path(moduleID, mg, scratch);
 
     std::string_view ns = "";
 
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& modulePath = get(g.modulePaths, g, vertID);
-        auto moduleID1 = locate(modulePath, mg);
-        if (moduleID1 != moduleID)
-            continue;
-
+    for (const auto& vertID : g.getModuleVertices(modulePath)) {
         const auto& traits = get(g.traits, g, vertID);
 
         if (traits.mImport)
@@ -60,12 +57,7 @@ std::pmr::string generateJsbConversions_h(const ModuleBuilder& builder, uint32_t
     }
 
     
-    for (int count = 0; const auto& vertID : make_range(vertices(g))) {
-        const auto& modulePath = get(g.modulePaths, g, vertID);
-        auto moduleID1 = locate(modulePath, mg);
-        if (moduleID1 != moduleID)
-            continue;
-
+    for (int count = 0; const auto& vertID : g.getModuleVertices(modulePath)) {
         const auto& traits = get(g.traits, g, vertID);
 
         if (traits.mImport)
@@ -113,27 +105,23 @@ std::pmr::string generateJsbConversions_h(const ModuleBuilder& builder, uint32_t
             });
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string generateJsbConversions_cpp(const ModuleBuilder& builder, uint32_t moduleID) {
-    auto scratch = builder.mScratch;
-    pmr_ostringstream oss(std::ios::out, scratch);
+    auto scratch = getThreadScratch(builder.mScratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     const auto& g = builder.mSyntaxGraph;
     const auto& mg = builder.mModuleGraph;
+    const auto modulePath = get_path(moduleID, mg, scratch);
 
     std::string_view ns = "";
 
     bool hasVariantTag = false;
 
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& modulePath = get(g.modulePaths, g, vertID);
-        auto moduleID1 = locate(modulePath, mg);
-        if (moduleID1 != moduleID)
-            continue;
-
+    for (const auto& vertID : g.getModuleVertices(modulePath)) {
         const auto& traits = get(g.traits, g, vertID);
 
         if (traits.mImport)
@@ -169,7 +157,7 @@ std::pmr::string generateJsbConversions_cpp(const ModuleBuilder& builder, uint32
                     }
 
                     for (const auto& member : s.mMembers) {
-                        auto memberID = locate(member.mTypePath, g);
+                        auto memberID = locate(member, g);
                         Expects(g.isJsb(memberID, mg));
                         oss << "\n";
                         OSS << "nativevalue_to_se(from." << member.getMemberName() << ", tmp, ctx);\n";
@@ -206,12 +194,7 @@ std::pmr::string generateJsbConversions_cpp(const ModuleBuilder& builder, uint32
             });
     }
 
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& modulePath = get(g.modulePaths, g, vertID);
-        auto moduleID1 = locate(modulePath, mg);
-        if (moduleID1 != moduleID)
-            continue;
-
+    for (const auto& vertID : g.getModuleVertices(modulePath)) {
         const auto& traits = get(g.traits, g, vertID);
 
         if (traits.mImport)
@@ -250,7 +233,7 @@ std::pmr::string generateJsbConversions_cpp(const ModuleBuilder& builder, uint32
                     OSS << "se::Value field;\n";
 
                     for (const auto& member : s.mMembers) {
-                        auto memberID = locate(member.mTypePath, g);
+                        auto memberID = locate(member, g);
                         Expects(g.isJsb(memberID, mg));
                         OSS << "obj->getProperty(\"" << member.getMemberName() << "\", &field, true);\n";
                         OSS << "if(!field.isNullOrUndefined()) {\n";
@@ -290,7 +273,7 @@ std::pmr::string generateJsbConversions_cpp(const ModuleBuilder& builder, uint32
             });
     }
 
-    auto result = oss.str();
+    auto result = oss.release();
     if (hasVariantTag) {
         result.insert(0, "#include \"cocos/renderer/pipeline/custom/Overload.h\"\n");
     }
@@ -0,0 +1,144 @@
+#include "NameCache.h"
+#include <mutex>
+#include <shared_mutex>
+
+namespace Cocos::Meta {
+
+struct NameCache::State {
+    std::optional<std::string_view> find(Kind kind, std::string_view scope, uint64_t subject) const {
+        std::shared_lock lock(mMutex);
+        auto scopeIter = mSymbols.find(scope);
+        if (scopeIter != mSymbols.end()) {
+            const auto& entries = mEntries[kind];
+            auto iter = entries.find(getKey(scopeIter->second, subject));
+            if (iter != entries.end()) {
+                ++mHits;
+                return iter->second;
+            }
+        }
+        ++mMisses;
+        return std::nullopt;
+    }
+
+    // must be called with the unique lock held
+    uint32_t intern(std::string_view str) {
+        auto iter = mSymbols.find(str);
+        if (iter != mSymbols.end()) {
+            return iter->second;
+        }
+        const auto symbol = static_cast<uint32_t>(mSymbols.size());
+        mSymbols.emplace(copy(str), symbol);
+        return symbol;
+    }
+
+    // must be called with the unique lock held
+    std::string_view copy(std::string_view str) {
+        auto* data = static_cast<char*>(mArena.allocate(str.size() + 1, 1));
+        str.copy(data, str.size());
+        data[str.size()] = '\0';
+        return { data, str.size() };
+    }
+
+    std::string_view emplace(Kind kind, std::string_view scope, uint64_t subject, std::string_view value) {
+        std::unique_lock lock(mMutex);
+        const auto key = getKey(intern(scope), subject);
+        auto& entries = mEntries[kind];
+        auto iter = entries.find(key);
+        if (iter == entries.end()) {
+            iter = entries.emplace(key, copy(value)).first;
+        }
+        return iter->second;
+    }
+
+    static uint64_t getKey(uint32_t scope, uint64_t subject) noexcept {
+        return (static_cast<uint64_t>(scope) << 32) | subject;
+    }
+
+    mutable std::shared_mutex mMutex;
+    std::pmr::monotonic_buffer_resource mArena;
+    std::pmr::unordered_map<std::string_view, uint32_t> mSymbols{ &mArena };
+    std::pmr::unordered_map<uint64_t, std::string_view> mEntries[KindCount] = {
+        std::pmr::unordered_map<uint64_t, std::string_view>(&mArena),
+        std::pmr::unordered_map<uint64_t, std::string_view>(&mArena),
+        std::pmr::unordered_map<uint64_t, std::string_view>(&mArena),
+        std::pmr::unordered_map<uint64_t, std::string_view>(&mArena),
+    };
+    mutable std::atomic<uint64_t> mHits = 0;
+    mutable std::atomic<uint64_t> mMisses = 0;
+};
+
+NameCache::NameCache() noexcept = default;
+NameCache::NameCache(NameCache&& rhs) noexcept = default;
+
+NameCache::NameCache(const NameCache& rhs) noexcept {}
+
+NameCache& NameCache::operator=(NameCache&& rhs) noexcept = default;
+
+NameCache& NameCache::operator=(const NameCache& rhs) noexcept {
+    mState.reset();
+    return *this;
+}
+
+NameCache::~NameCache() noexcept = default;
+
+void NameCache::enable() {
+    mState = std::make_unique<State>();
+}
+
+void NameCache::invalidate() noexcept {
+    mState.reset();
+}
+
+std::optional<std::string_view> NameCache::find(Kind kind,
+    std::string_view scope, uint32_t vertID) const {
+    if (!mState) {
+        return std::nullopt;
+    }
+    return mState->find(kind, scope, vertID);
+}
+
+std::optional<std::string_view> NameCache::find(Kind kind,
+    std::string_view scope, std::string_view name) const {
+    if (!mState) {
+        return std::nullopt;
+    }
+    uint32_t nameID = 0;
+    {
+        std::shared_lock lock(mState->mMutex);
+        auto iter = mState->mSymbols.find(name);
+        if (iter == mState->mSymbols.end()) {
+            ++mState->mMisses;
+            return std::nullopt;
+        }
+        nameID = iter->second;
+    }
+    return mState->find(kind, scope, nameID);
+}
+
+std::string_view NameCache::emplace(Kind kind, std::string_view scope, uint32_t vertID, std::string_view value) const {
+    if (!mState) {
+        return value;
+    }
+    return mState->emplace(kind, scope, vertID, value);
+}
+
+std::string_view NameCache::emplace(Kind kind, std::string_view scope, std::string_view name, std::string_view value) const {
+    if (!mState) {
+        return value;
+    }
+    uint32_t nameID = 0;
+    {
+        std::unique_lock lock(mState->mMutex);
+        nameID = mState->intern(name);
+    }
+    return mState->emplace(kind, scope, nameID, value);
+}
+
+NameCache::Stats NameCache::getStats() const noexcept {
+    if (!mState) {
+        return {};
+    }
+    return { mState->mHits.load(), mState->mMisses.load() };
+}
+
+} // namespace Cocos::Meta
@@ -0,0 +1,60 @@
+#pragma once
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <memory_resource>
+#include <optional>
+#include <string_view>
+
+namespace Cocos::Meta {
+
+// Memoizes name resolution of a compiled SyntaxGraph.
+// Entries are keyed by (scope, subject) and stored in an arena owned by the cache.
+// The cache is disabled until enable() is called, and any mutation of the graph must call invalidate().
+// Copies of the cache start empty and disabled.
+class NameCache {
+public:
+    enum Kind : uint32_t {
+        DependentName,
+        DependentCppName,
+        TypescriptTypename,
+        TypePath,
+        KindCount,
+    };
+
+    struct Stats {
+        uint64_t mHits = 0;
+        uint64_t mMisses = 0;
+    };
+
+    NameCache() noexcept;
+    NameCache(NameCache&& rhs) noexcept;
+    NameCache(const NameCache& rhs) noexcept;
+    NameCache& operator=(NameCache&& rhs) noexcept;
+    NameCache& operator=(const NameCache& rhs) noexcept;
+    ~NameCache() noexcept;
+
+    void enable();
+    void invalidate() noexcept;
+    bool enabled() const noexcept {
+        return mState != nullptr;
+    }
+
+    std::optional<std::string_view> find(Kind kind,
+        std::string_view scope, uint32_t vertID) const;
+    std::optional<std::string_view> find(Kind kind,
+        std::string_view scope, std::string_view name) const;
+
+    // Returns the cached value, which lives in the arena until invalidate() is called.
+    // A disabled cache returns value itself.
+    std::string_view emplace(Kind kind, std::string_view scope, uint32_t vertID, std::string_view value) const;
+    std::string_view emplace(Kind kind, std::string_view scope, std::string_view name, std::string_view value) const;
+
+    Stats getStats() const noexcept;
+
+private:
+    struct State;
+    std::unique_ptr<State> mState;
+};
+
+} // namespace Cocos::Meta
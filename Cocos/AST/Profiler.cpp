@@ -0,0 +1,185 @@
+#include "Profiler.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iomanip>
+#include <map>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace Cocos::Meta {
+
+namespace {
+
+struct ProfileEvent {
+    std::string_view mName;
+    std::string mDetail;
+    uint32_t mThreadID = 0;
+    int64_t mStart = 0;
+    int64_t mDuration = 0;
+    uint64_t mAllocations = 0;
+    uint64_t mBytes = 0;
+};
+
+struct ProfileSession {
+    const std::chrono::steady_clock::time_point mEpoch = std::chrono::steady_clock::now();
+    std::atomic<uint32_t> mNextThreadID = 0;
+    std::mutex mMutex;
+    std::vector<ProfileEvent> mEvents;
+};
+
+ProfileSession& getSession() {
+    static ProfileSession sSession;
+    return sSession;
+}
+
+int64_t getMicroseconds() noexcept {
+    const auto elapsed = std::chrono::steady_clock::now() - getSession().mEpoch;
+    return std::chrono::duration_cast<std::chrono::microseconds>(elapsed).count();
+}
+
+uint32_t getThreadID() noexcept {
+    thread_local const uint32_t sThreadID = getSession().mNextThreadID++;
+    return sThreadID;
+}
+
+thread_local uint64_t sAllocations = 0;
+thread_local uint64_t sBytes = 0;
+
+void writeJsonString(std::ostream& os, std::string_view str) {
+    os << '"';
+    for (const char c : str) {
+        switch (c) {
+        case '"':
+            os << "\\\"";
+            break;
+        case '\\':
+            os << "\\\\";
+            break;
+        case '\n':
+            os << "\\n";
+            break;
+        default:
+            os << c;
+            break;
+        }
+    }
+    os << '"';
+}
+
+} // namespace
+
+void* ProfileMemoryResource::do_allocate(size_t bytes, size_t alignment) {
+    ++sAllocations;
+    sBytes += bytes;
+    return mUpstream->allocate(bytes, alignment);
+}
+
+void ProfileMemoryResource::do_deallocate(void* p, size_t bytes, size_t alignment) {
+    mUpstream->deallocate(p, bytes, alignment);
+}
+
+bool ProfileMemoryResource::do_is_equal(const std::pmr::memory_resource& rhs) const noexcept {
+    return this == &rhs;
+}
+
+ProfileScope::ProfileScope(std::string_view name, std::string_view detail) noexcept
+    : mName(name)
+    , mDetail(detail)
+    , mStart(getMicroseconds())
+    , mAllocations(sAllocations)
+    , mBytes(sBytes) {}
+
+ProfileScope::~ProfileScope() noexcept {
+    const auto end = getMicroseconds();
+    auto& session = getSession();
+    try {
+        ProfileEvent event{
+            .mName = mName,
+            .mDetail = std::string(mDetail),
+            .mThreadID = getThreadID(),
+            .mStart = mStart,
+            .mDuration = end - mStart,
+            .mAllocations = sAllocations - mAllocations,
+            .mBytes = sBytes - mBytes,
+        };
+        std::lock_guard<std::mutex> lock(session.mMutex);
+        session.mEvents.emplace_back(std::move(event));
+    } catch (...) {
+        // profiling must never break generation
+    }
+}
+
+void writeProfileTrace(const std::filesystem::path& filename) {
+    auto& session = getSession();
+    std::lock_guard<std::mutex> lock(session.mMutex);
+
+    std::ofstream ofs(filename, std::ios::binary);
+    ofs.exceptions(std::ostream::failbit);
+    ofs << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n";
+    for (size_t i = 0; i != session.mEvents.size(); ++i) {
+        const auto& e = session.mEvents[i];
+        if (i) {
+            ofs << ",\n";
+        }
+        ofs << "{\"name\":";
+        writeJsonString(ofs, e.mName);
+        ofs << ",\"cat\":\"generator\",\"ph\":\"X\",\"pid\":0"
+            << ",\"tid\":" << e.mThreadID
+            << ",\"ts\":" << e.mStart
+            << ",\"dur\":" << e.mDuration
+            << ",\"args\":{";
+        if (!e.mDetail.empty()) {
+            ofs << "\"detail\":";
+            writeJsonString(ofs, e.mDetail);
+            ofs << ",";
+        }
+        ofs << "\"allocations\":" << e.mAllocations
+            << ",\"bytes\":" << e.mBytes << "}}";
+    }
+    ofs << "\n]}\n";
+}
+
+void printProfileSummary(std::ostream& os) {
+    struct Summary {
+        uint64_t mCalls = 0;
+        int64_t mDuration = 0;
+        uint64_t mAllocations = 0;
+        uint64_t mBytes = 0;
+    };
+
+    std::map<std::string_view, Summary> summaries;
+    {
+        auto& session = getSession();
+        std::lock_guard<std::mutex> lock(session.mMutex);
+        for (const auto& e : session.mEvents) {
+            auto& s = summaries[e.mName];
+            ++s.mCalls;
+            s.mDuration += e.mDuration;
+            s.mAllocations += e.mAllocations;
+            s.mBytes += e.mBytes;
+        }
+    }
+
+    std::vector<std::pair<std::string_view, Summary>> sorted(summaries.begin(), summaries.end());
+    std::stable_sort(sorted.begin(), sorted.end(), [](const auto& lhs, const auto& rhs) {
+        return lhs.second.mDuration > rhs.second.mDuration;
+    });
+
+    os << std::left << std::setw(40) << "phase"
+       << std::right << std::setw(8) << "calls"
+       << std::setw(12) << "ms"
+       << std::setw(14) << "allocations"
+       << std::setw(14) << "KiB" << "\n";
+    for (const auto& [name, s] : sorted) {
+        os << std::left << std::setw(40) << name
+           << std::right << std::setw(8) << s.mCalls
+           << std::setw(12) << std::fixed << std::setprecision(3) << static_cast<double>(s.mDuration) / 1000.0
+           << std::setw(14) << s.mAllocations
+           << std::setw(14) << s.mBytes / 1024 << "\n";
+    }
+}
+
+} // namespace Cocos::Meta
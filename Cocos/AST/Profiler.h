@@ -0,0 +1,62 @@
+#pragma once
+#include <cstdint>
+#include <filesystem>
+#include <memory_resource>
+#include <ostream>
+#include <string_view>
+
+// Define CC_GENERATOR_PROFILE=1 to record generator phases.
+// When disabled, PROFILE_SCOPE compiles to nothing and its arguments are not evaluated.
+#ifndef CC_GENERATOR_PROFILE
+#define CC_GENERATOR_PROFILE 0
+#endif
+
+namespace Cocos::Meta {
+
+// Forwards to upstream and counts allocations of the calling thread,
+// so that each ProfileScope can report the allocations made inside it.
+class ProfileMemoryResource final : public std::pmr::memory_resource {
+public:
+    explicit ProfileMemoryResource(std::pmr::memory_resource* upstream) noexcept
+        : mUpstream(upstream) {}
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override;
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override;
+    bool do_is_equal(const std::pmr::memory_resource& rhs) const noexcept override;
+
+    std::pmr::memory_resource* mUpstream = nullptr;
+};
+
+// Records the duration and allocations between construction and destruction.
+// name must outlive the profiling session, detail only needs to outlive the scope.
+class ProfileScope {
+public:
+    explicit ProfileScope(std::string_view name, std::string_view detail = {}) noexcept;
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+    ~ProfileScope() noexcept;
+
+private:
+    std::string_view mName;
+    std::string_view mDetail;
+    int64_t mStart = 0;
+    uint64_t mAllocations = 0;
+    uint64_t mBytes = 0;
+};
+
+// Chrome trace_event format, open in chrome://tracing or https://ui.perfetto.dev
+void writeProfileTrace(const std::filesystem::path& filename);
+
+// Inclusive time and allocations, aggregated by scope name
+void printProfileSummary(std::ostream& os);
+
+} // namespace Cocos::Meta
+
+#if CC_GENERATOR_PROFILE
+#define PROFILE_CONCAT_IMPL(a, b) a##b
+#define PROFILE_CONCAT(a, b) PROFILE_CONCAT_IMPL(a, b)
+#define PROFILE_SCOPE(...) ::Cocos::Meta::ProfileScope PROFILE_CONCAT(profileScope, __LINE__)(__VA_ARGS__)
+#else
+#define PROFILE_SCOPE(...) ((void)0)
+#endif
@@ -0,0 +1,642 @@
+#include "Snapshot.h"
+#include "BuilderTypes.h"
+#include "SyntaxGraphs.h"
+#include "Profiler.h"
+#include <Cocos/FileUtils.h>
+#include <boost/interprocess/file_mapping.hpp>
+#include <boost/interprocess/mapped_region.hpp>
+#include <Cocos/Overload.h>
+#include <algorithm>
+#include <cstring>
+
+namespace Cocos::Meta {
+
+namespace {
+
+// "CCSS" in little endian
+constexpr uint32_t sSnapshotMagic = 0x53534343;
+
+// bump when a serialized type gains, loses or reorders a field
+constexpr uint32_t sSnapshotVersion = 10;
+
+// File layout, all integers are little endian:
+//   SnapshotHeader
+//   uint32_t offsets[mNumStrings + 1], string i is [offsets[i], offsets[i + 1]) of the string data
+//   char data[mStringsSize]
+//   std::byte records[mRecordsSize]
+struct SnapshotHeader {
+    uint32_t mMagic = sSnapshotMagic;
+    uint32_t mVersion = sSnapshotVersion;
+    uint32_t mNumStrings = 0;
+    uint32_t mReserved = 0;
+    uint64_t mStringsSize = 0;
+    uint64_t mRecordsSize = 0;
+};
+
+template <class T, class U>
+concept Like = std::is_same_v<std::remove_const_t<T>, U>;
+
+// Fields of every serialized type, shared by the writer and the reader
+
+template <class Archive, Like<Instance> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mTemplate, v.mParameters);
+}
+
+template <class Archive, Like<Define> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mContent);
+}
+
+template <class Archive, Like<Concept> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mParentPath);
+}
+
+template <class Archive, Like<Constraints> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mConcepts);
+}
+
+template <class Archive, Like<Base> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mTypePath, v.mVirtualBase, v.mImplements);
+}
+
+template <class Archive, Like<Inherits> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mBases);
+}
+
+template <class Archive, Like<Alias> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mTypePath);
+}
+
+template <class Archive, Like<Traits> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mClass, v.mImport, v.mExport, v.mInterface, v.mPmr, v.mNoexcept,
+        v.mUnknown, v.mTrivial, v.mFinal, v.mFlags, v.mAlignment);
+}
+
+template <class Archive, Like<EnumValue> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mName, v.mValue, v.mReflectionName, v.mComment, v.mExport, v.mAlias);
+}
+
+template <class Archive, Like<Enum> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mIsFlags, v.mEnumOperator, v.mHasName, v.mUnderlyingType, v.mValues);
+}
+
+template <class Archive, Like<Tag> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mEntity);
+}
+
+template <class Archive, Like<Member> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mTypePath, v.mMemberName, v.mDefaultValue, v.mComments,
+        v.mConst, v.mPointer, v.mReference, v.mPublic, v.mFlags,
+        v.mTypescriptType, v.mTypescriptDefaultValue,
+        v.mTypescriptArray, v.mTypescriptOptional);
+}
+
+template <class Archive, Like<Parameter> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mTypePath, v.mName, v.mDefaultValue, v.mComment,
+        v.mConst, v.mPointer, v.mReference, v.mRvalue, v.mOptional);
+}
+
+template <class Archive, Like<Method> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mReturnType, v.mFunctionName, v.mParameters, v.mComment,
+        v.mVirtual, v.mConst, v.mNoexcept, v.mPure, v.mStatic,
+        v.mGetter, v.mSetter, v.mOptional, v.mSkip, v.mCovariant, v.mFlags);
+}
+
+template <class Archive, Like<Constructor> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mIndices, v.mHasDefault);
+}
+
+template <class Archive, Like<Struct> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mMembers, v.mConstructors, v.mMemberFunctions,
+        v.mTypescriptMembers, v.mTypescriptFunctions, v.mMethods);
+}
+
+template <class Archive, Like<Variant> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mVariants, v.mUseIndex);
+}
+
+template <class Archive, Like<PolymorphicPair> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mTag, v.mValue, v.mMemberName, v.mContainerPath, v.mVector);
+}
+
+template <class Archive, Like<Polymorphic> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mConcepts);
+}
+
+template <class Archive, Like<Component> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mName, v.mValuePath, v.mMemberName, v.mContainerPath, v.mVector);
+}
+
+template <class Archive, Like<VertexMap> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mMapType, v.mMemberName, v.mKeyType,
+        v.mComponentName, v.mComponentMemberName, v.mTypePath);
+}
+
+template <class Archive, Like<Named> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mComponent, v.mComponentName, v.mComponentMemberName);
+}
+
+template <class Archive, Like<Addressable> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mUtf8, v.mPathPropertyMap, v.mType, v.mMemberName);
+}
+
+template <class Archive, Like<SmallVector_> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mCapacity);
+}
+
+template <class Archive, Like<Graph> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mMembers, v.mConstructors, v.mMemberFunctions, v.mMethods,
+        v.mVertexProperty, v.mEdgeProperty, v.mComponents);
+    ar(v.mIncidence, v.mAdjacency, v.mUndirected, v.mBidirectional,
+        v.mVertexList, v.mEdgeList, v.mMutableGraphVertex, v.mMutableGraphEdge,
+        v.mNamed, v.mReferenceGraph, v.mAliasGraph, v.mAddressable,
+        v.mAddressIndex, v.mMutableReference, v.mColorMap, v.mPackedColorMap, v.mCsrFreeze,
+        v.mFragment, v.mOrderedDag, v.mObjectRanges, v.mLevels);
+    ar(v.mPolymorphic, v.mVertexListType, v.mEdgeListType, v.mOutEdgeListType,
+        v.mVertexListPath, v.mEdgeListPath, v.mOutEdgeListPath, v.mVertexDescriptor,
+        v.mVertexSizeType, v.mDifferenceType, v.mEdgeSizeType,
+        v.mEdgeDifferenceType, v.mDegreeSizeType);
+    ar(v.mVertexMaps, v.mNamedConcept, v.mAddressableConcept,
+        v.mTypescriptMembers, v.mTypescriptFunctions);
+}
+
+template <class Archive, Like<Typescript> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mName, v.mArray);
+}
+
+template <class Archive, Like<Comment> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mComment, v.mParameterComments);
+}
+
+template <class Archive, Like<ModuleInfo> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mFeatures, v.mFolder, v.mFilePrefix, v.mJsbHeaders,
+        v.mToJsFilename, v.mToJsPrefix, v.mToJsNamespace,
+        v.mToJsHppHeaders, v.mToJsCppHeaders, v.mToJsUsingNamespace, v.mToJsConfigs,
+        v.mTypescriptFolder, v.mTypescriptFilePrefix, v.mAPI, v.mRequires,
+        v.mHeader, v.mTypescriptInclude, v.mTail);
+}
+
+template <class Archive, Like<SyntaxGraph::object_type> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mChildren, v.mParents);
+}
+
+template <class Archive, Like<SyntaxGraph::vertex_type> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mOutEdges, v.mInEdges, v.mHandle);
+}
+
+template <class Archive, Like<SyntaxGraph> T>
+void serialize(Archive& ar, T& g) {
+    ar(g.mObjects, g.mVertices);
+    ar(g.mNames, g.mTraits, g.mConstraints, g.mInherits,
+        g.mModulePaths, g.mTypescripts, g.mComments);
+    ar(g.mDefines, g.mConcepts, g.mAliases, g.mEnums, g.mTags,
+        g.mStructs, g.mGraphs, g.mVariants, g.mInstances);
+    ar(g.mPathIndex);
+}
+
+template <class Archive, Like<ModuleGraph::object_type> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mChildren, v.mParents);
+}
+
+template <class Archive, Like<ModuleGraph::vertex_type> T>
+void serialize(Archive& ar, T& v) {
+    ar(v.mOutEdges, v.mInEdges);
+}
+
+template <class Archive, Like<ModuleGraph> T>
+void serialize(Archive& ar, T& g) {
+    ar(g.mObjects, g.mVertices, g.mNames, g.mModules, g.mPathIndex);
+}
+
+template <class Variant, size_t... I>
+void emplaceAlternative(Variant& v, size_t index, std::index_sequence<I...>) {
+    ((index == I ? (void)v.template emplace<I>() : (void)0), ...);
+}
+
+class SnapshotWriter {
+public:
+    explicit SnapshotWriter(std::pmr::memory_resource* scratch)
+        : mIndex(scratch)
+        , mStrings(scratch)
+        , mRecords(scratch) {}
+
+    template <class... Args>
+    void operator()(const Args&... args) {
+        (write(args), ...);
+    }
+
+    std::pmr::string finish() const {
+        SnapshotHeader header;
+        header.mNumStrings = gsl::narrow_cast<uint32_t>(mStrings.size());
+
+        std::pmr::vector<uint32_t> offsets(mRecords.get_allocator());
+        offsets.reserve(mStrings.size() + 1);
+        uint32_t offset = 0;
+        for (const auto& str : mStrings) {
+            offsets.emplace_back(offset);
+            offset += gsl::narrow_cast<uint32_t>(str.size());
+        }
+        offsets.emplace_back(offset);
+        header.mStringsSize = offset;
+        header.mRecordsSize = mRecords.size();
+
+        std::pmr::string content(mRecords.get_allocator());
+        content.reserve(sizeof(header) + offsets.size() * sizeof(uint32_t)
+            + header.mStringsSize + header.mRecordsSize);
+        content.append(reinterpret_cast<const char*>(&header), sizeof(header));
+        content.append(reinterpret_cast<const char*>(offsets.data()),
+            offsets.size() * sizeof(uint32_t));
+        for (const auto& str : mStrings) {
+            content.append(str);
+        }
+        content.append(mRecords);
+        return content;
+    }
+
+private:
+    void writeBytes(const void* data, size_t size) {
+        mRecords.append(static_cast<const char*>(data), size);
+    }
+    void write(bool value) {
+        const uint8_t v = value;
+        writeBytes(&v, sizeof(v));
+    }
+    void write(uint32_t value) {
+        writeBytes(&value, sizeof(value));
+    }
+    void write(uint64_t value) {
+        writeBytes(&value, sizeof(value));
+    }
+    template <class T>
+        requires std::is_enum_v<T>
+    void write(T value) {
+        write(static_cast<uint64_t>(value));
+    }
+    void write(std::string_view str) {
+        auto iter = mIndex.find(str);
+        if (iter == mIndex.end()) {
+            iter = mIndex.emplace(str, gsl::narrow_cast<uint32_t>(mStrings.size())).first;
+            mStrings.emplace_back(str);
+        }
+        write(iter->second);
+    }
+    void write(const std::pmr::string& str) {
+        write(std::string_view(str));
+    }
+    void write(const std::string& str) {
+        write(std::string_view(str));
+    }
+    void write(const Impl::StoredEdge<uint32_t>& e) {
+        write(e.m_target);
+    }
+    template <class T, class Allocator>
+    void write(const std::vector<T, Allocator>& values) {
+        write(gsl::narrow_cast<uint32_t>(values.size()));
+        for (const auto& v : values) {
+            write(v);
+        }
+    }
+    template <class Key, class Value, class Compare, class Allocator>
+    void write(const std::map<Key, Value, Compare, Allocator>& values) {
+        write(gsl::narrow_cast<uint32_t>(values.size()));
+        for (const auto& [key, value] : values) {
+            write(key);
+            write(value);
+        }
+    }
+    template <class... Ts>
+    void write(const std::variant<Ts...>& v) {
+        write(gsl::narrow_cast<uint32_t>(v.index()));
+        std::visit(
+            [&](const auto& alt) {
+                // handles of vertices stored in a per-type vector
+                if constexpr (requires { { alt.mValue } -> std::convertible_to<uint32_t>; }) {
+                    write(static_cast<uint32_t>(alt.mValue));
+                } else if constexpr (requires { serialize(*this, alt); }) {
+                    serialize(*this, alt);
+                }
+            },
+            v);
+    }
+    template <class T>
+        requires std::is_class_v<T>
+    void write(const T& v) {
+        serialize(*this, v);
+    }
+
+    PmrUnorderedStringMap<std::string_view, uint32_t> mIndex;
+    std::pmr::vector<std::string_view> mStrings;
+    std::pmr::string mRecords;
+};
+
+class SnapshotReader {
+public:
+    explicit SnapshotReader(std::span<const char> content) {
+        SnapshotHeader header;
+        if (content.size() < sizeof(header)) {
+            throw std::runtime_error("snapshot: file too small");
+        }
+        std::memcpy(&header, content.data(), sizeof(header));
+        if (header.mMagic != sSnapshotMagic) {
+            throw std::runtime_error("snapshot: invalid file");
+        }
+        if (header.mVersion != sSnapshotVersion) {
+            throw std::runtime_error("snapshot: version mismatch");
+        }
+        const uint64_t offsetsSize = (uint64_t(header.mNumStrings) + 1) * sizeof(uint32_t);
+        if (content.size() != sizeof(header) + offsetsSize + header.mStringsSize + header.mRecordsSize) {
+            throw std::runtime_error("snapshot: size mismatch");
+        }
+        mOffsets = content.data() + sizeof(header);
+        mNumStrings = header.mNumStrings;
+        mStrings = std::string_view(mOffsets + offsetsSize, header.mStringsSize);
+        mRecords = content.subspan(sizeof(header) + offsetsSize + header.mStringsSize);
+    }
+
+    template <class... Args>
+    void operator()(Args&... args) {
+        (read(args), ...);
+    }
+
+    bool finished() const noexcept {
+        return mPosition == mRecords.size();
+    }
+
+private:
+    void readBytes(void* data, size_t size) {
+        if (mRecords.size() - mPosition < size) {
+            throw std::runtime_error("snapshot: truncated records");
+        }
+        std::memcpy(data, mRecords.data() + mPosition, size);
+        mPosition += size;
+    }
+    void read(bool& value) {
+        uint8_t v = 0;
+        readBytes(&v, sizeof(v));
+        value = v;
+    }
+    void read(uint32_t& value) {
+        readBytes(&value, sizeof(value));
+    }
+    void read(uint64_t& value) {
+        readBytes(&value, sizeof(value));
+    }
+    template <class T>
+        requires std::is_enum_v<T>
+    void read(T& value) {
+        uint64_t v = 0;
+        read(v);
+        value = static_cast<T>(v);
+    }
+    std::string_view readString() {
+        uint32_t id = 0;
+        read(id);
+        if (id >= mNumStrings) {
+            throw std::runtime_error("snapshot: invalid string");
+        }
+        uint32_t range[2];
+        std::memcpy(range, mOffsets + id * sizeof(uint32_t), sizeof(range));
+        if (range[0] > range[1] || range[1] > mStrings.size()) {
+            throw std::runtime_error("snapshot: invalid string");
+        }
+        return mStrings.substr(range[0], range[1] - range[0]);
+    }
+    void read(std::pmr::string& str) {
+        str = readString();
+    }
+    void read(std::string& str) {
+        str = readString();
+    }
+    uint32_t readSize() {
+        uint32_t sz = 0;
+        read(sz);
+        // every element takes at least one byte
+        if (sz > mRecords.size() - mPosition) {
+            throw std::runtime_error("snapshot: invalid size");
+        }
+        return sz;
+    }
+    template <class Allocator>
+    void read(std::vector<Impl::StoredEdge<uint32_t>, Allocator>& edges) {
+        const auto sz = readSize();
+        edges.reserve(sz);
+        for (uint32_t i = 0; i != sz; ++i) {
+            uint32_t target = 0;
+            read(target);
+            edges.emplace_back(target);
+        }
+    }
+    template <class T, class Allocator>
+    void read(std::vector<T, Allocator>& values) {
+        const auto sz = readSize();
+        values.reserve(sz);
+        for (uint32_t i = 0; i != sz; ++i) {
+            read(values.emplace_back());
+        }
+    }
+    template <class Key, class Value, class Compare, class Allocator>
+    void read(std::map<Key, Value, Compare, Allocator>& values) {
+        const auto sz = readSize();
+        for (uint32_t i = 0; i != sz; ++i) {
+            Key key(values.get_allocator());
+            read(key);
+            read(values[std::move(key)]);
+        }
+    }
+    template <class... Ts>
+    void read(std::variant<Ts...>& v) {
+        uint32_t index = 0;
+        read(index);
+        if (index >= sizeof...(Ts)) {
+            throw std::runtime_error("snapshot: invalid variant");
+        }
+        emplaceAlternative(v, index, std::index_sequence_for<Ts...>{});
+        std::visit(
+            [&](auto& alt) {
+                if constexpr (requires { { alt.mValue } -> std::convertible_to<uint32_t>; }) {
+                    uint32_t value = 0;
+                    read(value);
+                    alt.mValue = value;
+                } else if constexpr (requires { serialize(*this, alt); }) {
+                    serialize(*this, alt);
+                }
+            },
+            v);
+    }
+    template <class T>
+        requires std::is_class_v<T>
+    void read(T& v) {
+        serialize(*this, v);
+    }
+
+    const char* mOffsets = nullptr;
+    uint32_t mNumStrings = 0;
+    std::string_view mStrings;
+    std::span<const char> mRecords;
+    size_t mPosition = 0;
+};
+
+// Descriptors read from the file index the loaded vectors.
+// A stale or corrupt snapshot must be rejected before anything dereferences them.
+template <class EdgeList>
+bool isValidEdgeList(const EdgeList& edges, size_t numVertices) noexcept {
+    return std::all_of(edges.begin(), edges.end(), [numVertices](const auto& e) {
+        return e.get_target() < numVertices;
+    });
+}
+
+template <class Graph>
+bool isValidStructure(const Graph& g) noexcept {
+    const auto numVertices = g.mVertices.size();
+    for (const auto& v : g.mVertices) {
+        if (!isValidEdgeList(v.mOutEdges, numVertices)
+            || !isValidEdgeList(v.mInEdges, numVertices)) {
+            return false;
+        }
+    }
+    for (const auto& obj : g.mObjects) {
+        if (!isValidEdgeList(obj.mChildren, numVertices)
+            || !isValidEdgeList(obj.mParents, numVertices)) {
+            return false;
+        }
+    }
+    for (const auto& [path, vertID] : g.mPathIndex) {
+        if (vertID >= numVertices) {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool isValidHandle(const SyntaxGraph& g, const SyntaxGraph::vertex_handle_type& handle) noexcept {
+    return std::visit(
+        overload(
+            [&](const Impl::ValueHandle<Define_, SyntaxGraph::vertex_descriptor>& h) {
+                return h.mValue < g.mDefines.size();
+            },
+            [&](const Impl::ValueHandle<Concept_, SyntaxGraph::vertex_descriptor>& h) {
+                return h.mValue < g.mConcepts.size();
+            },
+            [&](const Impl::ValueHandle<Alias_, SyntaxGraph::vertex_descriptor>& h) {
+                return h.mValue < g.mAliases.size();
+            },
+            [&](const Impl::ValueHandle<Enum_, SyntaxGraph::vertex_descriptor>& h) {
+                return h.mValue < g.mEnums.size();
+            },
+            [&](const Impl::ValueHandle<Tag_, SyntaxGraph::vertex_descriptor>& h) {
+                return h.mValue < g.mTags.size();
+            },
+            [&](const Impl::ValueHandle<Struct_, SyntaxGraph::vertex_descriptor>& h) {
+                return h.mValue < g.mStructs.size();
+            },
+            [&](const Impl::ValueHandle<Graph_, SyntaxGraph::vertex_descriptor>& h) {
+                return h.mValue < g.mGraphs.size();
+            },
+            [&](const Impl::ValueHandle<Variant_, SyntaxGraph::vertex_descriptor>& h) {
+                return h.mValue < g.mVariants.size();
+            },
+            [&](const Impl::ValueHandle<Instance_, SyntaxGraph::vertex_descriptor>& h) {
+                return h.mValue < g.mInstances.size();
+            },
+            // values stored in the vertex
+            [](const auto&) {
+                return true;
+            }),
+        handle);
+}
+
+} // namespace
+
+void writeSnapshot(const std::filesystem::path& filename, const ModuleBuilder& builder) {
+    PROFILE_SCOPE("writeSnapshot");
+    Expects(builder.mCompiled);
+
+    SnapshotWriter ar(builder.mScratch);
+    ar(builder.mProjectName, builder.mUnderscoreMemberName, builder.mBoost);
+    ar(builder.mSyntaxGraph, builder.mModuleGraph);
+
+    updateBinary(filename, ar.finish());
+}
+
+void readSnapshot(const std::filesystem::path& filename, ModuleBuilder& builder) {
+    PROFILE_SCOPE("readSnapshot");
+    auto& g = builder.mSyntaxGraph;
+    auto& mg = builder.mModuleGraph;
+    Expects(!builder.mCompiled);
+    Expects(num_vertices(g) == 0);
+    Expects(num_vertices(mg) == 0);
+
+    namespace bip = boost::interprocess;
+    const bip::file_mapping file(filename.string().c_str(), bip::read_only);
+    const bip::mapped_region region(file, bip::read_only);
+
+    SnapshotReader ar(std::span<const char>(
+        static_cast<const char*>(region.get_address()), region.get_size()));
+    ar(builder.mProjectName, builder.mUnderscoreMemberName, builder.mBoost);
+    ar(g, mg);
+    if (!ar.finished()) {
+        throw std::runtime_error("snapshot: trailing records");
+    }
+
+    // every component is indexed by vertex
+    const auto numVertices = g.mVertices.size();
+    if (g.mObjects.size() != numVertices
+        || g.mNames.size() != numVertices
+        || g.mTraits.size() != numVertices
+        || g.mConstraints.size() != numVertices
+        || g.mInherits.size() != numVertices
+        || g.mModulePaths.size() != numVertices
+        || g.mTypescripts.size() != numVertices
+        || g.mComments.size() != numVertices
+        || mg.mObjects.size() != mg.mVertices.size()
+        || mg.mNames.size() != mg.mVertices.size()
+        || mg.mModules.size() != mg.mVertices.size()) {
+        throw std::runtime_error("snapshot: inconsistent graph");
+    }
+    if (!isValidStructure(g) || !isValidStructure(mg)) {
+        throw std::runtime_error("snapshot: vertex out of range");
+    }
+    for (const auto& v : g.mVertices) {
+        if (!isValidHandle(g, v.mHandle)) {
+            throw std::runtime_error("snapshot: handle out of range");
+        }
+    }
+
+    // derived data, same as the end of ModuleBuilder::compile
+    g.bindSymbols();
+    g.buildModuleIndex();
+    g.mNameCache.enable();
+    builder.mCompiled = true;
+}
+
+} // namespace Cocos::Meta
@@ -0,0 +1,17 @@
+#pragma once
+#include <Cocos/AST/BuilderFwd.h>
+
+namespace Cocos::Meta {
+
+// Binary image of a compiled ModuleBuilder: the SyntaxGraph, the ModuleGraph and the project settings.
+// Strings are stored once in a table and records refer to them by index, so the file has no pointers.
+// Symbols, module indices and name caches are derived data, they are rebuilt when loading.
+void writeSnapshot(const std::filesystem::path& filename, const ModuleBuilder& builder);
+
+// Loads a snapshot into an initialized and empty builder, which is compiled afterwards.
+// Throws std::runtime_error if the file is not a snapshot of the current version,
+// or if a descriptor in it is out of range. The builder must then be discarded,
+// and the schema built and compiled again.
+void readSnapshot(const std::filesystem::path& filename, ModuleBuilder& builder);
+
+} // namespace Cocos::Meta
@@ -6,12 +6,13 @@
 namespace Cocos::Meta {
 
 std::pmr::string generateSwigConfig(const ModuleBuilder& builder, uint32_t moduleID) {
-    auto scratch = builder.mScratch;
-    pmr_ostringstream oss(std::ios::out, scratch);
+    auto scratch = getThreadScratch(builder.mScratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     const auto& g = builder.mSyntaxGraph;
     const auto& mg = builder.mModuleGraph;
+    const auto modulePath = get_path(moduleID, mg, scratch);
 
     const auto& m = get(mg.modules, mg, moduleID);
 
@@ -45,7 +46,6 @@ std::pmr::string generateSwigConfig(const ModuleBuilder& builder, uint32_t modul
 )");
     copyString(oss, space, m.mToJsCppHeaders);
     {
-        auto modulePath = get_path(moduleID, mg, scratch);
         auto imported = g.getImportedTypes(modulePath, scratch);
         for (const auto& [depPath, types] : imported) {
             auto depID = locate(depPath, mg);
@@ -87,12 +87,7 @@ std::pmr::string generateSwigConfig(const ModuleBuilder& builder, uint32_t modul
 )");
     {
         int count = 0;
-        for (const auto& vertID : make_range(vertices(g))) {
-            const auto& modulePath = get(g.modulePaths, g, vertID);
-            auto moduleID1 = locate(modulePath, mg);
-            if (moduleID1 != moduleID)
-                continue;
-
+        for (const auto& vertID : g.getModuleVertices(modulePath)) {
             auto fullName = g.getDependentCppName("", vertID, scratch, scratch);
             const auto& traits = get(g.traits, g, vertID);
 
@@ -170,8 +165,8 @@ std::pmr::string generateSwigConfig(const ModuleBuilder& builder, uint32_t modul
     {
         auto outputParam = [&](const Method& m) {
             std::ostringstream oss;
-            auto retID = locate(m.mReturnType.mTypePath, g);
-            oss << g.getDependentCppName("", retID, scratch, scratch);
+            auto retID = locate(m.mReturnType, g);
+            oss << g.getCachedDependentCppName("", retID, scratch);
             if (m.mReturnType.mPointer) {
                 oss << "*";
             }
@@ -182,12 +177,7 @@ std::pmr::string generateSwigConfig(const ModuleBuilder& builder, uint32_t modul
         };
 
         int count = 0;
-        for (const auto& vertID : make_range(vertices(g))) {
-            const auto& modulePath = get(g.modulePaths, g, vertID);
-            auto moduleID1 = locate(modulePath, mg);
-            if (moduleID1 != moduleID)
-                continue;
-
+        for (const auto& vertID : g.getModuleVertices(modulePath)) {
             const auto& traits = get(g.traits, g, vertID);
 
             if (traits.mImport)
@@ -244,7 +234,7 @@ std::pmr::string generateSwigConfig(const ModuleBuilder& builder, uint32_t modul
 )");
     OSS << "%include \"" << folder << "/" << m.mFilePrefix << "Types.h\"\n";
 
-    return oss.str();
+    return oss.release();
 }
 
 }
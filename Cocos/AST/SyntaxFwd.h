@@ -121,14 +121,29 @@ struct Vector_;
 struct List_;
 struct Set_;
 struct MultiSet_;
+struct SmallVector_;
+struct SlotMap_;
+struct Pool_;
 template <> struct IsForward<Vector_> { static constexpr bool value = true; };
 template <> struct IsSequence<Vector_> { static constexpr bool value = true; };
 template <> struct IsBackInsertionSequence<Vector_> { static constexpr bool value = true; };
 
+template <> struct IsForward<SmallVector_> { static constexpr bool value = true; };
+template <> struct IsSequence<SmallVector_> { static constexpr bool value = true; };
+template <> struct IsBackInsertionSequence<SmallVector_> { static constexpr bool value = true; };
+
+template <> struct IsForward<SlotMap_> { static constexpr bool value = true; };
+template <> struct IsSequence<SlotMap_> { static constexpr bool value = true; };
+template <> struct IsBackInsertionSequence<SlotMap_> { static constexpr bool value = true; };
+
 template <> struct IsForward<List_> { static constexpr bool value = true; };
 template <> struct IsSequence<List_> { static constexpr bool value = true; };
 template <> struct IsBackInsertionSequence<List_> { static constexpr bool value = true; };
 
+template <> struct IsForward<Pool_> { static constexpr bool value = true; };
+template <> struct IsSequence<Pool_> { static constexpr bool value = true; };
+template <> struct IsBackInsertionSequence<Pool_> { static constexpr bool value = true; };
+
 template <> struct IsForward<Set_> { static constexpr bool value = true; };
 template <> struct IsAssociative<Set_> { static constexpr bool value = true; };
 template <> struct IsUniqueAssociative<Set_> { static constexpr bool value = true; };
@@ -137,14 +152,14 @@ template <> struct IsForward<MultiSet_> { static constexpr bool value = true; };
 template <> struct IsAssociative<MultiSet_> { static constexpr bool value = true; };
 template <> struct IsMultipleAssociative<MultiSet_> { static constexpr bool value = true; };
 
-using VertexListType = std::variant<Vector_, List_>;
-using EdgeListType = std::variant<List_, Set_, MultiSet_>;
-using OutEdgeListType = std::variant<Vector_, List_, Set_, MultiSet_>;
+using VertexListType = std::variant<Vector_, List_, SlotMap_>;
+using EdgeListType = std::variant<List_, Set_, MultiSet_, Pool_>;
+using OutEdgeListType = std::variant<Vector_, List_, Set_, MultiSet_, SmallVector_>;
 
 struct Direct_;
 struct Trie_;
 
-using PathIndexType = std::variant<Direct_, Map_>;
+using PathIndexType = std::variant<Direct_, Map_, Trie_>;
 
 struct Layer;
 struct Stack;
@@ -225,6 +240,7 @@ template <> struct IsInstantiation<Instance> { static constexpr bool value = tru
 enum class ImplEnum : uint32_t;
 
 struct Comment;
+struct ModuleIndex;
 struct SyntaxGraph;
 
 enum Features : uint32_t;
@@ -986,6 +986,16 @@ get(std::pmr::vector<boost::default_color_type>& colors, const SyntaxGraph& g) n
     return { colors };
 }
 
+[[nodiscard]] inline Impl::PackedColorMap<SyntaxGraph::vertex_descriptor>
+get(Impl::PackedColors& colors, const SyntaxGraph& g) noexcept {
+    return { colors };
+}
+
+[[nodiscard]] inline Impl::VisitedBitsetMap<SyntaxGraph::vertex_descriptor>
+get(Impl::VisitedBitset& visited, const SyntaxGraph& g) noexcept {
+    return { visited };
+}
+
 // Vertex Component
 inline typename boost::property_map<SyntaxGraph, SyntaxGraph::names_>::const_type
 get(SyntaxGraph::names_, const SyntaxGraph& g) noexcept {
@@ -1880,6 +1890,64 @@ locate(std::string_view absolute, const SyntaxGraph& g) noexcept {
     }
 };
 
+[[nodiscard]] inline SyntaxGraph::vertex_descriptor
+locate(SymbolID symbol, const SyntaxGraph& g) noexcept {
+    Expects(g.mSymbolsBound);
+    Expects(static_cast<uint32_t>(symbol) < g.mSymbolVertices.size());
+    return g.mSymbolVertices[static_cast<uint32_t>(symbol)];
+}
+
+// Type references are bound by SyntaxGraph::bindSymbols during compilation,
+// references created afterwards, or looked up after a vertex is removed,
+// fall back to the path index.
+[[nodiscard]] inline SyntaxGraph::vertex_descriptor
+locate(const Member& m, const SyntaxGraph& g) noexcept {
+    if (g.mSymbolsBound && m.mTypeSymbol != SymbolID::Invalid) {
+        return m.mTypeID;
+    }
+    return locate(m.mTypePath, g);
+}
+
+[[nodiscard]] inline SyntaxGraph::vertex_descriptor
+locate(const Parameter& param, const SyntaxGraph& g) noexcept {
+    if (g.mSymbolsBound && param.mTypeSymbol != SymbolID::Invalid) {
+        return param.mTypeID;
+    }
+    return locate(param.mTypePath, g);
+}
+
+[[nodiscard]] inline SyntaxGraph::vertex_descriptor
+locate(const Base& base, const SyntaxGraph& g) noexcept {
+    if (g.mSymbolsBound && base.mTypeSymbol != SymbolID::Invalid) {
+        return base.mTypeID;
+    }
+    return locate(base.mTypePath, g);
+}
+
+[[nodiscard]] inline SyntaxGraph::vertex_descriptor
+locate(const Component& c, const SyntaxGraph& g) noexcept {
+    if (g.mSymbolsBound && c.mValueSymbol != SymbolID::Invalid) {
+        return c.mValueID;
+    }
+    return locate(c.mValuePath, g);
+}
+
+[[nodiscard]] inline SyntaxGraph::vertex_descriptor
+locate(const PolymorphicPair& c, const SyntaxGraph& g) noexcept {
+    if (g.mSymbolsBound && c.mValueSymbol != SymbolID::Invalid) {
+        return c.mValueID;
+    }
+    return locate(c.mValue, g);
+}
+
+[[nodiscard]] inline SyntaxGraph::vertex_descriptor
+locate(const Instance& inst, const SyntaxGraph& g) noexcept {
+    if (g.mSymbolsBound && inst.mTemplateSymbol != SymbolID::Invalid) {
+        return inst.mTemplateID;
+    }
+    return locate(inst.mTemplate, g);
+}
+
 [[nodiscard]] inline SyntaxGraph::vertex_descriptor
 locate(SyntaxGraph::vertex_descriptor u, std::string_view relative, const SyntaxGraph& g) {
     Expects(!relative.starts_with('/'));
@@ -1963,6 +2031,8 @@ inline void add_path_impl(SyntaxGraph::vertex_descriptor u, SyntaxGraph::vertex_
     auto pathName = get_path(v, g, g.mPathIndex.get_allocator().resource());
     auto res = g.mPathIndex.emplace(std::move(pathName), v);
     Ensures(res.second);
+
+    g.mNameCache.invalidate();
 }
 
 inline void remove_path_impl(SyntaxGraph::vertex_descriptor u, SyntaxGraph& g) noexcept {
@@ -1977,6 +2047,8 @@ inline void remove_path_impl(SyntaxGraph::vertex_descriptor u, SyntaxGraph& g) n
             --v;
         }
     }
+    g.mSymbolsBound = false;
+    g.mNameCache.invalidate();
 }
 
 inline void clear_out_edges(SyntaxGraph::vertex_descriptor u, SyntaxGraph& g) noexcept {
@@ -2396,6 +2468,16 @@ get(std::pmr::vector<boost::default_color_type>& colors, const ModuleGraph& g) n
     return { colors };
 }
 
+[[nodiscard]] inline Impl::PackedColorMap<ModuleGraph::vertex_descriptor>
+get(Impl::PackedColors& colors, const ModuleGraph& g) noexcept {
+    return { colors };
+}
+
+[[nodiscard]] inline Impl::VisitedBitsetMap<ModuleGraph::vertex_descriptor>
+get(Impl::VisitedBitset& visited, const ModuleGraph& g) noexcept {
+    return { visited };
+}
+
 // Vertex Component
 inline typename boost::property_map<ModuleGraph, ModuleGraph::names_>::const_type
 get(ModuleGraph::names_, const ModuleGraph& g) noexcept {
@@ -34,9 +34,9 @@ namespace Cocos::Meta {
 std::pmr::string Member::getMemberName() const {
     Expects(mMemberName.size() > 1);
     if (mPublic) {
-        return camelToVariable(mMemberName.substr(1), get_allocator().resource());
+        return camelToVariable(mMemberName.substr(1), getThreadScratch(get_allocator().resource()));
     } else {
-        auto name = camelToVariable(mMemberName.substr(1), get_allocator().resource());
+        auto name = camelToVariable(mMemberName.substr(1), getThreadScratch(get_allocator().resource()));
         name.insert(name.begin(), '_');
         return name;
     }
@@ -44,11 +44,12 @@ std::pmr::string Member::getMemberName() const {
 
 std::pmr::string SyntaxGraph::getMemberName(std::string_view memberName, bool bPublic) const {
     Expects(memberName.size() >= 2);
-    std::pmr::string name(mScratch);
+    auto scratch = getThreadScratch(mScratch);
+    std::pmr::string name(scratch);
     if (bPublic) {
-        name = camelToVariable(memberName.substr(1), mScratch);
+        name = camelToVariable(memberName.substr(1), scratch);
     } else {
-        name = camelToVariable(memberName.substr(1), mScratch);
+        name = camelToVariable(memberName.substr(1), scratch);
         name.insert(name.begin(), '_');
     }
     return name;
@@ -64,14 +65,14 @@ bool SyntaxGraph::isNamespace(std::string_view typePath) const noexcept {
 }
 
 bool SyntaxGraph::isInterface(vertex_descriptor vertID) const noexcept {
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
     const auto& g = *this;
     const auto& traits = get(g.traits, g, vertID);
     return traits.mInterface;
 }
 
 bool SyntaxGraph::isIntrusivePtr(vertex_descriptor vertID) const noexcept {
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
     const auto& g = *this;
     if (g.isInstantiation(vertID)) {
         auto typePath = g.getTypePath(vertID, scratch);
@@ -114,7 +115,7 @@ bool SyntaxGraph::isValueType(const Parameter& param) const {
     if (param.mPointer || param.mReference) {
         return true;
     }
-    const auto paramID = locate(param.mTypePath, *this);
+    const auto paramID = locate(param, *this);
     return isValueType(paramID);
 }
 
@@ -163,7 +164,7 @@ bool SyntaxGraph::isPmr(vertex_descriptor vertID) const noexcept {
     auto checkStruct = [&](const Composition_ auto& s) {
         bool bPmr = false;
         for (const auto& m : s.mMembers) {
-            auto memberID = locate(m.mTypePath, g);
+            auto memberID = locate(m, g);
             if (memberID == vertID)
                 continue;
 
@@ -184,13 +185,13 @@ bool SyntaxGraph::isPmr(vertex_descriptor vertID) const noexcept {
         [&](const Graph& s) {
             bool bPmr = checkStruct(s);
             for (const auto& c : s.mComponents) {
-                auto componentID = locate(c.mValuePath, g);
+                auto componentID = locate(c, g);
                 Expects(componentID != vertID);
                 if (g.isPmr(componentID))
                     bPmr = true;
             }
             for (const auto& c : s.mPolymorphic.mConcepts) {
-                auto objectID = locate(c.mValue, g);
+                auto objectID = locate(c, g);
                 Expects(objectID != vertID);
                 if (g.isPmr(objectID))
                     bPmr = true;
@@ -199,7 +200,7 @@ bool SyntaxGraph::isPmr(vertex_descriptor vertID) const noexcept {
         },
         [&](const Instance& s) {
             const auto optionalID = locate("/std/optional", g);
-            auto templateID = locate(s.mTemplate, g);
+            auto templateID = locate(s, g);
             const auto& traits = get(g.traits, g, templateID);
 
             if (traits.mPmr)
@@ -240,7 +241,7 @@ bool SyntaxGraph::isNoexcept(vertex_descriptor vertID) const noexcept {
         [&](const Composition_ auto& s) {
             bool bThrow = false;
             for (const auto& m : s.mMembers) {
-                auto memberID = locate(m.mTypePath, g);
+                auto memberID = locate(m, g);
                 if (memberID == vertID)
                     continue;
 
@@ -253,7 +254,7 @@ bool SyntaxGraph::isNoexcept(vertex_descriptor vertID) const noexcept {
             return !bThrow;
         },
         [&](const Instance& s) {
-            auto templateID = locate(s.mTemplate, g);
+            auto templateID = locate(s, g);
             const auto& traits = get(g.traits, g, templateID);
             bool bThrow = false;
             if (!traits.mNoexcept)
@@ -345,7 +346,7 @@ bool SyntaxGraph::isPoolObject(vertex_descriptor vertID) const noexcept {
     auto checkStruct = [&](const Composition_ auto& s) {
         bool bPoolObject = false;
         for (const auto& m : s.mMembers) {
-            auto memberID = locate(m.mTypePath, g);
+            auto memberID = locate(m, g);
             if (memberID == vertID)
                 continue;
 
@@ -369,13 +370,13 @@ bool SyntaxGraph::isPoolObject(vertex_descriptor vertID) const noexcept {
         [&](const Graph& s) {
             bool bPoolObject = checkStruct(s);
             for (const auto& c : s.mComponents) {
-                auto componentID = locate(c.mValuePath, g);
+                auto componentID = locate(c, g);
                 Expects(componentID != vertID);
                 if (g.isPoolObject(componentID))
                     bPoolObject = true;
             }
             for (const auto& c : s.mPolymorphic.mConcepts) {
-                auto objectID = locate(c.mValue, g);
+                auto objectID = locate(c, g);
                 Expects(objectID != vertID);
                 if (g.isPoolObject(objectID))
                     bPoolObject = true;
@@ -384,7 +385,7 @@ bool SyntaxGraph::isPoolObject(vertex_descriptor vertID) const noexcept {
         },
         [&](const Instance& s) {
             const auto optionalID = locate("/std/optional", g);
-            auto templateID = locate(s.mTemplate, g);
+            auto templateID = locate(s, g);
 
             if (s.mTemplate == "/std/shared_ptr"
                 || s.mTemplate == "/std/weak_ptr")
@@ -420,7 +421,7 @@ bool SyntaxGraph::isDLL(vertex_descriptor vertID, const ModuleGraph& mg) const n
 
 bool SyntaxGraph::isJsb(vertex_descriptor vertID, const ModuleGraph& mg) const noexcept {
     const auto& g = *this;
-    auto* scratch = g.mScratch;
+    auto* scratch = getThreadScratch(g.mScratch);
 
     if (g.isValueType(vertID))
         return true;
@@ -435,7 +436,7 @@ bool SyntaxGraph::isJsb(vertex_descriptor vertID, const ModuleGraph& mg) const n
         }
         if (g.isInstantiation(vertID)) {
             auto& inst = get<Instance>(vertID, g);
-            auto templateID = locate(inst.mTemplate, g);
+            auto templateID = locate(inst, g);
             const auto& traits = get(g.traits, g, templateID);
             auto type = g.getTypescriptTypename(templateID, scratch, scratch);
             if (type == "Map" || type == "Array" || type == "Set" || (traits.mFlags & JSB)) {
@@ -477,7 +478,7 @@ bool SyntaxGraph::hasNoMoveBase(vertex_descriptor vertID) const noexcept {
     const auto& g = *this;
     const auto& bases = get(g.inherits, g, vertID).mBases;
     for (const auto& base : bases) {
-        auto baseID = locate(base.mTypePath, g);
+        auto baseID = locate(base, g);
         if (g.hasNoMoveBase(baseID)) {
             return true;
         }
@@ -493,7 +494,7 @@ bool SyntaxGraph::hasNoCopyBase(vertex_descriptor vertID) const noexcept {
     const auto& g = *this;
     const auto& bases = get(g.inherits, g, vertID).mBases;
     for (const auto& base : bases) {
-        auto baseID = locate(base.mTypePath, g);
+        auto baseID = locate(base, g);
         if (g.hasNoCopyBase(baseID)) {
             return true;
         }
@@ -509,7 +510,7 @@ bool SyntaxGraph::hasConcreteBase(vertex_descriptor vertID) const noexcept {
     const auto& g = *this;
     const auto& bases = get(g.inherits, g, vertID).mBases;
     for (const auto& base : bases) {
-        auto baseID = locate(base.mTypePath, g);
+        auto baseID = locate(base, g);
         if (g.hasConcreteBase(baseID)) {
             return true;
         }
@@ -685,7 +686,7 @@ bool SyntaxGraph::hasPmrOptional(vertex_descriptor vertID) const noexcept {
         vertID, g,
         [&](const Composition_ auto& s) {
             for (const Member& m : s.mMembers) {
-                auto typeID = locate(m.mTypePath, g);
+                auto typeID = locate(m, g);
                 if (g.isOptional(typeID)) {
                     const auto& inst = get<Instance>(typeID, g);
                     Expects(inst.mParameters.size() == 1);
@@ -708,7 +709,7 @@ bool SyntaxGraph::hasString(vertex_descriptor vertID) const noexcept {
         vertID, g,
         [&](const Composition_ auto& s) {
             for (const Member& m : s.mMembers) {
-                auto typeID = locate(m.mTypePath, g);
+                auto typeID = locate(m, g);
                 if (g.isString(typeID)) {
                     return true;
                 }
@@ -782,7 +783,7 @@ bool SyntaxGraph::hasVirtualInheritance(vertex_descriptor vertID) const noexcept
 
     // has special bases
     for (const auto& base : bases) {
-        const auto baseID = locate(base.mTypePath, g);
+        const auto baseID = locate(base, g);
         if (baseID == vertID)
             continue;
 
@@ -805,7 +806,7 @@ bool SyntaxGraph::hasType(vertex_descriptor vertID, vertex_descriptor typeID) co
             vertID, g,
             [&](const Struct& s) {
                 for (const auto& member : s.mMembers) {
-                    const auto& memberID = locate(member.mTypePath, g);
+                    const auto& memberID = locate(member, g);
                     if (memberID == vertID)
                         continue;
                     if (hasType(memberID, typeID))
@@ -815,21 +816,21 @@ bool SyntaxGraph::hasType(vertex_descriptor vertID, vertex_descriptor typeID) co
             },
             [&](const Graph& s) {
                 for (const auto& component : s.mComponents) {
-                    const auto& componentID = locate(component.mValuePath, g);
+                    const auto& componentID = locate(component, g);
                     if (componentID == vertID)
                         continue;
                     if (hasType(componentID, typeID))
                         return true;
                 }
                 for (const auto& c : s.mPolymorphic.mConcepts) {
-                    const auto& objectID = locate(c.mValue, g);
+                    const auto& objectID = locate(c, g);
                     if (objectID == vertID)
                         continue;
                     if (hasType(objectID, typeID))
                         return true;
                 }
                 for (const auto& member : s.mMembers) {
-                    const auto& memberID = locate(member.mTypePath, g);
+                    const auto& memberID = locate(member, g);
                     if (memberID == vertID)
                         continue;
                     if (hasType(memberID, typeID))
@@ -868,7 +869,7 @@ bool SyntaxGraph::hasConsecutiveParameters(
                 if (!isParam)
                     continue;
 
-                auto currType = std::make_tuple(locate(m.mTypePath, g), m.mReference, m.mPointer);
+                auto currType = std::make_tuple(locate(m, g), m.mReference, m.mPointer);
                 if (currType == prevType)
                     return true;
 
@@ -883,12 +884,13 @@ bool SyntaxGraph::hasConsecutiveParameters(
 
 std::pmr::vector<BaseConstructor> SyntaxGraph::getBaseConstructors(vertex_descriptor vertID) const {
     const auto& g = *this;
-    std::pmr::vector<BaseConstructor> results(get_allocator());
+    const allocator_type alloc(getThreadScratch(get_allocator().resource()));
+    std::pmr::vector<BaseConstructor> results(alloc);
     const auto& bases = get(g.inherits, g, vertID).mBases;
     for (const auto& base : bases) {
-        const auto baseID = locate(base.mTypePath, g);
+        const auto baseID = locate(base, g);
         Expects(g.isComposition(baseID));
-        BaseConstructor cntr(get_allocator());
+        BaseConstructor cntr(alloc);
         {
             auto baseCntrs = getBaseConstructors(baseID);
             cntr.mBaseID = baseID;
@@ -905,9 +907,11 @@ std::pmr::vector<BaseConstructor> SyntaxGraph::getBaseConstructors(vertex_descri
                     Expects(s.mConstructors.size() == 1);
                     for (const auto& k : s.mConstructors.front().mIndices) {
                         const auto& m = s.mMembers.at(k);
-                        Parameter param(get_allocator());
+                        Parameter param(alloc);
                         param.mTypePath = m.mTypePath;
-                        param.mName = getParameterName(m.mMemberName, get_allocator().resource());
+                        param.mTypeSymbol = m.mTypeSymbol;
+                        param.mTypeID = m.mTypeID;
+                        param.mName = getParameterName(m.mMemberName, alloc.resource());
                         param.mConst = m.mConst;
                         param.mPointer = m.mPointer;
                         param.mReference = m.mReference;
@@ -937,7 +941,7 @@ SyntaxGraph::vertex_descriptor SyntaxGraph::getMemberType(
                 if (m.mMemberName != member) {
                     continue;
                 }
-                return locate(m.mTypePath, g);
+                return locate(m, g);
             }
             return g.null_vertex();
         },
@@ -952,7 +956,7 @@ SyntaxGraph::vertex_descriptor SyntaxGraph::getFirstMemberString(vertex_descript
         vertID, g,
         [&](const Composition_ auto& s) {
             for (const Member& m : s.mMembers) {
-                auto typeID = locate(m.mTypePath, g);
+                auto typeID = locate(m, g);
                 if (g.isString(typeID) && !g.isUtf8(typeID)) {
                     return typeID;
                 }
@@ -970,7 +974,7 @@ SyntaxGraph::vertex_descriptor SyntaxGraph::getFirstMemberUtf8(vertex_descriptor
         vertID, g,
         [&](const Composition_ auto& s) {
             for (const Member& m : s.mMembers) {
-                auto typeID = locate(m.mTypePath, g);
+                auto typeID = locate(m, g);
                 if (g.isString(typeID) && g.isUtf8(typeID)) {
                     return typeID;
                 }
@@ -989,7 +993,7 @@ void collectBasesImpl(const SyntaxGraph& g,
     std::pmr::set<SyntaxGraph::vertex_descriptor>& baseIDs,
     std::pmr::vector<SyntaxGraph::vertex_descriptor>& results) {
     for (const auto& base : bases) {
-        auto baseID = locate(base.mTypePath, g);
+        auto baseID = locate(base, g);
         auto& childBases = get(g.inherits, g, baseID).mBases;
         collectBasesImpl(g, childBases, baseIDs, results);
         if (!baseIDs.contains(baseID)) {
@@ -1004,7 +1008,7 @@ void collectOverridedImpl(const SyntaxGraph& g,
     std::pmr::set<SyntaxGraph::vertex_descriptor>& baseIDs,
     std::pmr::vector<SyntaxGraph::vertex_descriptor>& results) {
     for (const auto& base : bases) {
-        auto baseID = locate(base.mTypePath, g);
+        auto baseID = locate(base, g);
         auto& bases = get(g.inherits, g, baseID).mBases;
         if (!g.isInterface(baseID)) {
             collectBasesImpl(g, bases, baseIDs, results);
@@ -1019,7 +1023,7 @@ void collectOverridedImpl(const SyntaxGraph& g,
 
 std::pmr::set<SyntaxGraph::vertex_descriptor>
 SyntaxGraph::collectOverrided(vertex_descriptor vertID) const {
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
     const auto& g = *this;
     const auto& inherits = get(g.inherits, g, vertID);
     std::pmr::set<SyntaxGraph::vertex_descriptor> bases(scratch);
@@ -1033,7 +1037,7 @@ bool SyntaxGraph::isPathPmr(const Graph& s) const noexcept {
     const auto& g = *this;
     if (s.mNamedConcept.mComponent) {
         const auto& c = s.getComponent(s.mNamedConcept.mComponentName);
-        const auto componentID = locate(c.mValuePath, g);
+        const auto componentID = locate(c, g);
         if (s.mNamedConcept.mComponentMemberName.empty()) {
             return g.isPmr(componentID);
         } else {
@@ -1042,7 +1046,7 @@ bool SyntaxGraph::isPathPmr(const Graph& s) const noexcept {
                 [&](const Composition_ auto& s1) {
                     for (const auto& member : s1.mMembers) {
                         if (member.mMemberName == s.mNamedConcept.mComponentMemberName) {
-                            auto memberID = locate(member.mTypePath, g);
+                            auto memberID = locate(member, g);
                             return g.isPmr(memberID);
                         }
                     }
@@ -1066,7 +1070,7 @@ bool SyntaxGraph::isPathPmr(const Graph& s) const noexcept {
                 [&](const Composition_ auto& s1) {
                     for (const auto& member : s1.mMembers) {
                         if (member.mMemberName == s.mNamedConcept.mComponentMemberName) {
-                            auto memberID = locate(member.mTypePath, g);
+                            auto memberID = locate(member, g);
                             return g.isPmr(memberID);
                         }
                     }
@@ -1149,6 +1153,17 @@ SyntaxGraph::lookupIdentifier(std::string_view currentScope, std::string_view de
 }
 
 std::pmr::string SyntaxGraph::getTypePath(
+    std::string_view currentScope,
+    std::string_view dependentName,
+    std::pmr::memory_resource* mr,
+    std::pmr::memory_resource* scratch) const {
+    if (mNameCache.enabled()) {
+        return std::pmr::string(getCachedTypePath(currentScope, dependentName, scratch), mr);
+    }
+    return getTypePathUncached(currentScope, dependentName, mr, scratch);
+}
+
+std::pmr::string SyntaxGraph::getTypePathUncached(
     std::string_view currentScope,
     std::string_view dependentName,
     std::pmr::memory_resource* mr,
@@ -1237,6 +1252,14 @@ std::pmr::string SyntaxGraph::getTypePath(
 }
 
 std::pmr::string SyntaxGraph::getDependentName(std::string_view ns, vertex_descriptor vertID,
+    std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const {
+    if (mNameCache.enabled()) {
+        return std::pmr::string(getCachedDependentName(ns, vertID, scratch), mr);
+    }
+    return getDependentNameUncached(ns, vertID, mr, scratch);
+}
+
+std::pmr::string SyntaxGraph::getDependentNameUncached(std::string_view ns, vertex_descriptor vertID,
     std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const {
     if (!isInstanceDependent(vertID)) {
         auto typePath = getTypePath(vertID, mr);
@@ -1253,7 +1276,7 @@ std::pmr::string SyntaxGraph::getDependentName(std::string_view ns, vertex_descr
     std::pmr::vector<std::pmr::string> parameters(scratch);
     auto suffix = extractTemplate(typePath, name, parameters);
 
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
 
     std::pmr::string templateName(getDependentPath(ns, name), scratch);
     oss << templateName << "<";
@@ -1280,11 +1303,52 @@ std::pmr::string SyntaxGraph::getDependentName(std::string_view ns, vertex_descr
 }
 
 std::pmr::string SyntaxGraph::getDependentCppName(std::string_view ns, vertex_descriptor vertID,
+    std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const {
+    if (mNameCache.enabled()) {
+        return std::pmr::string(getCachedDependentCppName(ns, vertID, scratch), mr);
+    }
+    return getDependentCppNameUncached(ns, vertID, mr, scratch);
+}
+
+std::pmr::string SyntaxGraph::getDependentCppNameUncached(std::string_view ns, vertex_descriptor vertID,
     std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const {
     auto typePath = getDependentName(ns, vertID, scratch, scratch);
     return getCppPath(typePath, mr);
 }
 
+std::string_view SyntaxGraph::getCachedTypePath(std::string_view currentScope,
+    std::string_view dependentName, std::pmr::memory_resource* scratch) const {
+    Expects(mNameCache.enabled());
+    if (dependentName.empty()) {
+        return {};
+    }
+    if (auto typePath = mNameCache.find(NameCache::TypePath, currentScope, dependentName)) {
+        return *typePath;
+    }
+    const auto typePath = getTypePathUncached(currentScope, dependentName, scratch, scratch);
+    return mNameCache.emplace(NameCache::TypePath, currentScope, dependentName, typePath);
+}
+
+std::string_view SyntaxGraph::getCachedDependentName(std::string_view ns, vertex_descriptor vertID,
+    std::pmr::memory_resource* scratch) const {
+    Expects(mNameCache.enabled());
+    if (auto name = mNameCache.find(NameCache::DependentName, ns, vertID)) {
+        return *name;
+    }
+    const auto name = getDependentNameUncached(ns, vertID, scratch, scratch);
+    return mNameCache.emplace(NameCache::DependentName, ns, vertID, name);
+}
+
+std::string_view SyntaxGraph::getCachedDependentCppName(std::string_view ns, vertex_descriptor vertID,
+    std::pmr::memory_resource* scratch) const {
+    Expects(mNameCache.enabled());
+    if (auto name = mNameCache.find(NameCache::DependentCppName, ns, vertID)) {
+        return *name;
+    }
+    const auto name = getDependentCppNameUncached(ns, vertID, scratch, scratch);
+    return mNameCache.emplace(NameCache::DependentCppName, ns, vertID, name);
+}
+
 SyntaxGraph::vertex_descriptor
 SyntaxGraph::lookupType(std::string_view currentScope, std::string_view dependentName,
     std::pmr::memory_resource* scratch) const {
@@ -1470,17 +1534,17 @@ void SyntaxGraph::propagate(vertex_descriptor vertID, GenerationFlags flags) {
             for (const Member& m : s.mMembers) {
                 if (m.mPointer || m.mReference)
                     continue;
-                auto memberID = locate(m.mTypePath, g);
+                auto memberID = locate(m, g);
                 propagate(memberID, flags);
             }
         },
         [&](const Graph& s) {
             for (const auto& c : s.mComponents) {
-                auto componentID = locate(c.mValuePath, g);
+                auto componentID = locate(c, g);
                 propagate(componentID, flags);
             }
             for (const auto& c : s.mPolymorphic.mConcepts) {
-                auto conceptID = locate(c.mValue, g);
+                auto conceptID = locate(c, g);
                 propagate(conceptID, flags);
             }
             for (const Member& m : s.mMembers) {
@@ -1490,7 +1554,7 @@ void SyntaxGraph::propagate(vertex_descriptor vertID, GenerationFlags flags) {
                 if (m.mFlags & NOT_ELEMENT) {
                     continue;
                 }
-                auto memberID = locate(m.mTypePath, g);
+                auto memberID = locate(m, g);
                 propagate(memberID, flags);
             }
         },
@@ -1527,167 +1591,225 @@ SyntaxGraph::vertex_descriptor SyntaxGraph::getTemplate(
 }
 
 bool SyntaxGraph::moduleHasMap(std::string_view modulePath, std::string_view mapPath) const {
-    const auto& g = *this;
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& path = get(g.modulePaths, g, vertID);
-        if (path == modulePath) {
-            if (visit_vertex(
-                    vertID, g,
-                    [&](const Composition_ auto& s) {
-                        for (const auto& member : s.mMembers) {
-                            const auto& memberID = locate(member.mTypePath, g);
-                            if (holds_tag<Instance_>(memberID, g)) {
-                                const auto& inst = get<Instance>(memberID, g);
-                                if (inst.mTemplate == mapPath)
-                                    return true;
-                            }
-                        }
-                        return false;
-                    },
-                    [&](const auto&) {
-                        return false;
-                    })) {
-                return true;
-            }
-        }
-    }
-    return false;
+    auto iter = mModuleIndex.find(modulePath);
+    if (iter == mModuleIndex.end())
+        return false;
+    return iter->second.mMemberTemplates.contains(mapPath);
 }
 
 bool SyntaxGraph::moduleHasContainer(std::string_view modulePath, std::string_view typePath) const {
-    const auto& g = *this;
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& path = get(g.modulePaths, g, vertID);
-        if (path == modulePath) {
-            if (visit_vertex(
-                    vertID, g,
-                    [&](const Struct& s) {
-                        for (const auto& member : s.mMembers) {
-                            const auto& memberID = locate(member.mTypePath, g);
-                            if (holds_tag<Instance_>(memberID, g)) {
-                                const auto& inst = get<Instance>(memberID, g);
-                                if (inst.mTemplate == typePath)
-                                    return true;
-                            }
-                        }
-                        return false;
-                    },
-                    [&](const Graph& s) {
-                        for (const auto& component : s.mComponents) {
-                            const auto& componentID = locate(component.mValuePath, g);
-                            if (holds_tag<Instance_>(componentID, g)) {
-                                const auto& inst = get<Instance>(componentID, g);
-                                if (inst.mTemplate == typePath)
-                                    return true;
-                            }
-                        }
-
-                        for (const auto& c : s.mPolymorphic.mConcepts) {
-                            const auto& objectID = locate(c.mValue, g);
-                            if (holds_tag<Instance_>(objectID, g)) {
-                                const auto& inst = get<Instance>(objectID, g);
-                                if (inst.mTemplate == typePath)
-                                    return true;
-                            }
-                        }
-
-                        for (const auto& member : s.mMembers) {
-                            const auto& memberID = locate(member.mTypePath, g);
-                            if (holds_tag<Instance_>(memberID, g)) {
-                                const auto& inst = get<Instance>(memberID, g);
-                                if (inst.mTemplate == typePath)
-                                    return true;
-                            }
-                        }
-                        return false;
-                    },
-                    [&](const auto&) {
-                        return false;
-                    })) {
-                return true;
-            }
-        }
-    }
-    return false;
+    auto iter = mModuleIndex.find(modulePath);
+    if (iter == mModuleIndex.end())
+        return false;
+    return iter->second.mTemplates.contains(typePath);
 }
 
 bool SyntaxGraph::moduleHasType(std::string_view modulePath, std::string_view typePath) const {
     const auto& g = *this;
     const auto typeID = locate(typePath, g);
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& path = get(g.modulePaths, g, vertID);
-        if (path == modulePath) {
-            if (hasType(vertID, typeID))
-                return true;
-        }
+    for (const auto& vertID : g.getModuleVertices(modulePath)) {
+        if (hasType(vertID, typeID))
+            return true;
     }
     return false;
 }
 
 bool SyntaxGraph::moduleHasGraph(std::string_view modulePath) const {
+    auto iter = mModuleIndex.find(modulePath);
+    if (iter == mModuleIndex.end())
+        return false;
+    return iter->second.mHasGraph;
+}
+
+bool SyntaxGraph::moduleHasGraphSerialization(std::string_view modulePath) const {
+    auto iter = mModuleIndex.find(modulePath);
+    if (iter == mModuleIndex.end())
+        return false;
+    return iter->second.mHasGraphSerialization;
+}
+
+bool SyntaxGraph::moduleHasSmallEdgeList(std::string_view modulePath) const {
+    auto iter = mModuleIndex.find(modulePath);
+    if (iter == mModuleIndex.end())
+        return false;
+    return iter->second.mHasSmallEdgeList;
+}
+
+bool SyntaxGraph::moduleHasSlotMap(std::string_view modulePath) const {
+    auto iter = mModuleIndex.find(modulePath);
+    if (iter == mModuleIndex.end())
+        return false;
+    return iter->second.mHasSlotMap;
+}
+
+bool SyntaxGraph::moduleUsesHashCombine(std::string_view modulePath) const {
+    auto iter = mModuleIndex.find(modulePath);
+    if (iter == mModuleIndex.end())
+        return false;
+    return iter->second.mUsesHashCombine;
+}
+
+bool SyntaxGraph::moduleHasImpl(std::string_view modulePath, bool bDLL) const {
     const auto& g = *this;
-    bool hasGraph = false;
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& path = get(g.modulePaths, g, vertID);
-        if (path == modulePath) {
-            if (holds_tag<Graph_>(vertID, g)) {
-                hasGraph = true;
-                break;
-            }
-        }
+    for (const auto& vertID : g.getModuleVertices(modulePath)) {
+        if (g.hasImpl(vertID, bDLL))
+            return true;
     }
-    return hasGraph;
+    return false;
 }
 
-bool SyntaxGraph::moduleHasGraphSerialization(std::string_view modulePath) const {
+void SyntaxGraph::buildModuleIndex() {
     const auto& g = *this;
-    bool hasGraph = false;
+    mModuleIndex.clear();
+
     for (const auto& vertID : make_range(vertices(g))) {
-        const auto& path = get(g.modulePaths, g, vertID);
-        if (path == modulePath) {
-            if (holds_tag<Graph_>(vertID, g)) {
-                const auto& traits = get(g.traits, g, vertID);
-                if (!(traits.mFlags & NO_SERIALIZATION)) {
-                    hasGraph = true;
-                    break;
+        const auto& modulePath = get(g.modulePaths, g, vertID);
+        auto& index = mModuleIndex.try_emplace(modulePath).first->second;
+        index.mVertices.emplace_back(vertID);
+
+        const auto& traits = get(g.traits, g, vertID);
+        if (traits.mFlags & GenerationFlags::HASH_COMBINE) {
+            index.mUsesHashCombine = true;
+        }
+
+        auto getTemplate = [&](std::string_view typePath) -> const std::pmr::string* {
+            const auto typeID = locate(typePath, g);
+            if (typeID == g.null_vertex() || !holds_tag<Instance_>(typeID, g))
+                return nullptr;
+            return &get<Instance>(typeID, g).mTemplate;
+        };
+        auto addMembers = [&](const std::pmr::vector<Member>& members) {
+            for (const auto& member : members) {
+                if (const auto* templatePath = getTemplate(member.mTypePath)) {
+                    index.mMemberTemplates.emplace(*templatePath);
+                    index.mTemplates.emplace(*templatePath);
                 }
             }
-        }
+        };
+
+        visit_vertex(
+            vertID, g,
+            [&](const Struct& s) {
+                addMembers(s.mMembers);
+            },
+            [&](const Graph& s) {
+                index.mHasGraph = true;
+                if (!(traits.mFlags & NO_SERIALIZATION)) {
+                    index.mHasGraphSerialization = true;
+                }
+                if (s.hasSmallEdgeList()) {
+                    index.mHasSmallEdgeList = true;
+                }
+                if (s.isSlotMap()) {
+                    index.mHasSlotMap = true;
+                }
+                for (const auto& component : s.mComponents) {
+                    if (const auto* templatePath = getTemplate(component.mValuePath)) {
+                        index.mTemplates.emplace(*templatePath);
+                    }
+                }
+                for (const auto& c : s.mPolymorphic.mConcepts) {
+                    if (const auto* templatePath = getTemplate(c.mValue)) {
+                        index.mTemplates.emplace(*templatePath);
+                    }
+                }
+                addMembers(s.mMembers);
+            },
+            [&](const auto&) {
+            });
     }
-    return hasGraph;
 }
 
-bool SyntaxGraph::moduleUsesHashCombine(std::string_view modulePath) const {
-    const auto& g = *this;
-    bool usesHashCombine = false;
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& path = get(g.modulePaths, g, vertID);
-        if (path == modulePath) {
-            const auto& traits = get(g.traits, g, vertID);
-            if (traits.mFlags & GenerationFlags::HASH_COMBINE) {
-                usesHashCombine = true;
-                break;
-            }
-        }
+std::span<const SyntaxGraph::vertex_descriptor> SyntaxGraph::getModuleVertices(
+    std::string_view modulePath) const noexcept {
+    auto iter = mModuleIndex.find(modulePath);
+    if (iter == mModuleIndex.end())
+        return {};
+    return iter->second.mVertices;
+}
+
+SymbolID SyntaxGraph::intern(std::string_view typePath) {
+    auto iter = mSymbolIndex.find(typePath);
+    if (iter != mSymbolIndex.end()) {
+        return iter->second;
     }
-    return usesHashCombine;
+    const auto symbol = static_cast<SymbolID>(mSymbols.size());
+    mSymbols.emplace_back(typePath);
+    mSymbolVertices.emplace_back(locate(typePath, *this));
+    mSymbolIndex.emplace(mSymbols.back(), symbol);
+    return symbol;
 }
 
-bool SyntaxGraph::moduleHasImpl(std::string_view modulePath, bool bDLL) const {
-    const auto& g = *this;
+void SyntaxGraph::bindSymbols() {
+    auto& g = *this;
+    mSymbolIndex.clear();
+    mSymbols.clear();
+    mSymbolVertices.clear();
+
+    auto bind = [&](std::string_view typePath, SymbolID& symbol, vertex_descriptor& typeID) {
+        if (typePath.empty()) {
+            symbol = SymbolID::Invalid;
+            typeID = null_vertex();
+            return;
+        }
+        symbol = intern(typePath);
+        typeID = mSymbolVertices[static_cast<uint32_t>(symbol)];
+        if (typeID == null_vertex()) {
+            // unresolved, keep the path lookup in case it is instantiated later
+            symbol = SymbolID::Invalid;
+        }
+    };
+    auto bindMembers = [&](std::pmr::vector<Member>& members) {
+        for (auto& m : members) {
+            bind(m.mTypePath, m.mTypeSymbol, m.mTypeID);
+        }
+    };
+    auto bindParameters = [&](std::pmr::vector<Parameter>& params) {
+        for (auto& param : params) {
+            bind(param.mTypePath, param.mTypeSymbol, param.mTypeID);
+        }
+    };
+    auto bindMethods = [&](std::pmr::vector<Method>& methods) {
+        for (auto& method : methods) {
+            bind(method.mReturnType.mTypePath,
+                method.mReturnType.mTypeSymbol, method.mReturnType.mTypeID);
+            bindParameters(method.mParameters);
+        }
+    };
+
     for (const auto& vertID : make_range(vertices(g))) {
-        const auto& path = get(g.modulePaths, g, vertID);
-        if (path != modulePath) {
-            continue;
+        for (auto& base : get(g.inherits, g, vertID).mBases) {
+            bind(base.mTypePath, base.mTypeSymbol, base.mTypeID);
         }
-        if (g.hasImpl(vertID, bDLL))
-            return true;
+        visit_vertex(
+            vertID, g,
+            [&](Struct& s) {
+                bindMembers(s.mMembers);
+                bindMembers(s.mTypescriptMembers);
+                bindMethods(s.mMethods);
+            },
+            [&](Graph& s) {
+                bindMembers(s.mMembers);
+                bindMembers(s.mTypescriptMembers);
+                bindMethods(s.mMethods);
+                for (auto& c : s.mComponents) {
+                    bind(c.mValuePath, c.mValueSymbol, c.mValueID);
+                }
+                for (auto& c : s.mPolymorphic.mConcepts) {
+                    bind(c.mValue, c.mValueSymbol, c.mValueID);
+                }
+            },
+            [&](Instance& s) {
+                bind(s.mTemplate, s.mTemplateSymbol, s.mTemplateID);
+            },
+            [&](auto&) {
+            });
     }
-    return false;
+    mSymbolsBound = true;
 }
 
 bool SyntaxGraph::isTypescriptValueType(vertex_descriptor vertID) const {
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
     const auto& g = *this;
     if (holds_tag<Enum_>(vertID, g))
         return true;
@@ -1708,7 +1830,7 @@ bool SyntaxGraph::isTypescriptData(std::string_view name) const {
 }
 
 bool SyntaxGraph::isTypescriptBoolean(vertex_descriptor vertID) const {
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
     const auto& g = *this;
     auto typeName = g.getTypescriptTypename(vertID, scratch, scratch);
     if (typeName == "boolean")
@@ -1717,7 +1839,7 @@ bool SyntaxGraph::isTypescriptBoolean(vertex_descriptor vertID) const {
 }
 
 bool SyntaxGraph::isTypescriptNumber(vertex_descriptor vertID) const {
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
     const auto& g = *this;
     auto typeName = g.getTypescriptTypename(vertID, scratch, scratch);
     if (typeName == "number")
@@ -1726,7 +1848,7 @@ bool SyntaxGraph::isTypescriptNumber(vertex_descriptor vertID) const {
 }
 
 bool SyntaxGraph::isTypescriptString(vertex_descriptor vertID) const {
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
     const auto& g = *this;
     auto typeName = g.getTypescriptTypename(vertID, scratch, scratch);
     if (typeName == "string")
@@ -1759,7 +1881,7 @@ bool SyntaxGraph::isTypescriptArray(vertex_descriptor instanceID,
 }
 
 bool SyntaxGraph::isTypescriptSet(vertex_descriptor vertID) const {
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
     const auto& g = *this;
     if (!holds_tag<Instance_>(vertID, g)) {
         return false;
@@ -1783,7 +1905,7 @@ bool SyntaxGraph::isTypescriptSet(vertex_descriptor vertID) const {
 }
 
 bool SyntaxGraph::isTypescriptMap(vertex_descriptor vertID) const {
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
     const auto& g = *this;
     if (!holds_tag<Instance_>(vertID, g)) {
         return false;
@@ -1800,7 +1922,7 @@ bool SyntaxGraph::isTypescriptMap(vertex_descriptor vertID) const {
 
 bool SyntaxGraph::isTypescriptPointer(vertex_descriptor vertID) const {
     const auto& g = *this;
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
     if (holds_tag<Instance_>(vertID, g)) {
         if (!g.isTypescriptArray(vertID, scratch)) {
             auto templateID = g.getTemplate(vertID, scratch);
@@ -1814,6 +1936,14 @@ bool SyntaxGraph::isTypescriptPointer(vertex_descriptor vertID) const {
 }
 
 std::pmr::string SyntaxGraph::getTypescriptTypename(vertex_descriptor vertID,
+    std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const {
+    if (mNameCache.enabled()) {
+        return std::pmr::string(getCachedTypescriptTypename(vertID, scratch), mr);
+    }
+    return getTypescriptTypenameUncached(vertID, mr, scratch);
+}
+
+std::pmr::string SyntaxGraph::getTypescriptTypenameUncached(vertex_descriptor vertID,
     std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const {
     const auto& g = *this;
     
@@ -1904,6 +2034,19 @@ std::pmr::string SyntaxGraph::getTypescriptTypename(vertex_descriptor vertID,
     return result;
 }
 
+std::string_view SyntaxGraph::getCachedTypescriptTypename(vertex_descriptor vertID,
+    std::pmr::memory_resource* scratch) const {
+    Expects(mNameCache.enabled());
+    if (vertID == null_vertex()) {
+        return {};
+    }
+    if (auto name = mNameCache.find(NameCache::TypescriptTypename, {}, vertID)) {
+        return *name;
+    }
+    const auto name = getTypescriptTypenameUncached(vertID, scratch, scratch);
+    return mNameCache.emplace(NameCache::TypescriptTypename, {}, vertID, name);
+}
+
 std::pmr::string SyntaxGraph::getTypescriptTypename(std::string_view typePath,
     std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const {
     auto vertID = locate(typePath, *this);
@@ -1929,7 +2072,7 @@ std::pmr::string SyntaxGraph::getTypescriptInitialValue(
     vertex_descriptor vertID,
     std::string_view tsDefaultValue,
     std::string_view cppDefautValue, bool bPointer) const {
-    auto* scratch = mScratch;
+    auto* scratch = getThreadScratch(mScratch);
     const auto& g = *this;
     const auto& ts = get(g.typescripts, g, vertID);
     const auto& traits = get(g.traits, g, vertID);
@@ -1962,7 +2105,7 @@ std::pmr::string SyntaxGraph::getTypescriptInitialValue(
 
     std::string_view initial = initial1;
 
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
 
     auto generateInitialValue = [&]() {
         Expects(!initial.empty());
@@ -2061,7 +2204,7 @@ std::pmr::string SyntaxGraph::getTypescriptInitialValue(
     };
     if (bPointer || g.isTypescriptPointer(vertID)) {
         outputNull();
-        return oss.str();
+        return oss.release();
     }
 
     visit_vertex(
@@ -2117,7 +2260,7 @@ std::pmr::string SyntaxGraph::getTypescriptInitialValue(
             Expects(false);
         });
 
-    auto result = oss.str();
+    auto result = oss.release();
     Ensures(!result.empty());
     Ensures(!boost::algorithm::contains(result, "/"));
     return result;
@@ -2133,7 +2276,7 @@ std::pmr::string SyntaxGraph::getTypescriptGraphPolymorphicVariant(const Graph&
     std::pmr::memory_resource* mr,
     std::pmr::memory_resource* scratch) const {
     const auto& g = *this;
-    pmr_ostringstream oss(std::ios_base::out, mr);
+    CodeStream oss(mr);
     int count = 0;
     for (const auto& c : s.mPolymorphic.mConcepts) {
         if (count++) {
@@ -2141,14 +2284,14 @@ std::pmr::string SyntaxGraph::getTypescriptGraphPolymorphicVariant(const Graph&
         }
         oss << g.getTypescriptTypename(c.mValue, scratch, scratch);
     }
-    return oss.str();
+    return oss.release();
 }
 
 std::pmr::string SyntaxGraph::getTypedParameterName(const Parameter& p, bool bPublic, bool bFull, bool bOptional) const {
     const auto& g = *this;
-    auto scratch = mScratch;
+    auto scratch = getThreadScratch(mScratch);
 
-    auto memberID = locate(p.mTypePath, g);
+    auto memberID = locate(p, g);
     auto typeName = g.getTypescriptTypename(memberID, scratch, scratch);
     Expects(!typeName.empty());
 
@@ -2186,15 +2329,15 @@ void addImported(SyntaxGraph::vertex_descriptor vertID, const SyntaxGraph& g,
         [&](const Composition_ auto& s) {
             if (false) { // non-recursive
                 for (const Member& m : s.mMembers) {
-                    auto memberID = locate(m.mTypePath, g);
+                    auto memberID = locate(m, g);
                     addImported(memberID, g, modulePath, imported);
                 }
                 for (const Method& m : s.mMethods) {
                     for (const auto& param : m.mParameters) {
-                        auto paramID = locate(param.mTypePath, g);
+                        auto paramID = locate(param, g);
                         addImported(paramID, g, modulePath, imported);
                     }
-                    auto paramID = locate(m.mReturnType.mTypePath, g);
+                    auto paramID = locate(m.mReturnType, g);
                     addImported(paramID, g, modulePath, imported);
                 }
             }
@@ -2216,23 +2359,19 @@ PmrMap<std::pmr::string, PmrSet<std::pmr::string>> SyntaxGraph::getImportedTypes
     PmrMap<std::pmr::string, PmrSet<std::pmr::string>> imported(mr);
 
     const auto& g = *this;
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& path = get(g.modulePaths, g, vertID);
-        if (path != modulePath)
-            continue;
-
+    for (const auto& vertID : g.getModuleVertices(modulePath)) {
         visit_vertex(vertID, g,
             [&](const Composition_ auto& s) {
                 for (const Member& m : s.mMembers) {
-                    auto memberID = locate(m.mTypePath, g);
+                    auto memberID = locate(m, g);
                     addImported(memberID, g, modulePath, imported);
                 }
                 for (const Method& m : s.mMethods) {
                     for (const auto& param : m.mParameters) {
-                        auto paramID = locate(param.mTypePath, g);
+                        auto paramID = locate(param, g);
                         addImported(paramID, g, modulePath, imported);
                     }
-                    auto paramID = locate(m.mReturnType.mTypePath, g);
+                    auto paramID = locate(m.mReturnType, g);
                     addImported(paramID, g, modulePath, imported);
                 }
             },
@@ -2250,11 +2389,11 @@ PmrMap<std::pmr::string, PmrSet<std::pmr::string>> SyntaxGraph::getImportedTypes
                     addImported(typeID, g, modulePath, imported);
                 }
                 for (const auto& c : s.mComponents) {
-                    auto typeID = locate(c.mValuePath, g);
+                    auto typeID = locate(c, g);
                     addImported(typeID, g, modulePath, imported);
                 }
                 for (const auto& c : s.mPolymorphic.mConcepts) {
-                    auto typeID = locate(c.mValue, g);
+                    auto typeID = locate(c, g);
                     addImported(typeID, g, modulePath, imported);
                 }
             },
@@ -2270,6 +2409,9 @@ std::pmr::string Graph::getTypescriptVertexDescriptorType(
             [&](Vector_) {
                 return std::pmr::string("number", scratch);
             },
+            [&](SlotMap_) {
+                return std::pmr::string("number", scratch);
+            },
             [&](List_) {
                 return std::pmr::string(tsName, scratch) + "Vertex";
             }),
@@ -2306,7 +2448,7 @@ std::string_view Graph::getTypescriptReferenceDescriptorType() const {
 
 std::pmr::string Graph::getTypescriptVertexDereference(std::string_view v,
     std::pmr::memory_resource* scratch) const {
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
 
     if (isVector()) {
         oss << "this._vertices[" << v << "]";
@@ -2314,7 +2456,7 @@ std::pmr::string Graph::getTypescriptVertexDereference(std::string_view v,
         oss << v;
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::string_view Graph::getTypescriptOutEdgeList(bool bAddressable) const {
@@ -2344,10 +2486,17 @@ std::pmr::string Component::getTypescriptComponentType(const SyntaxGraph& g,
 }
 
 std::string_view Graph::getTypescriptNullVertex() const {
+    // numeric_limits<vertex_descriptor>::max() of the native graph
+    const auto maxVertex = mVertexDescriptor == "uint16_t"
+        ? std::string_view("0xFFFF")
+        : std::string_view("0xFFFFFFFF");
     return visit(
         overload(
             [&](Vector_) {
-                return std::string_view("0xFFFFFFFF");
+                return maxVertex;
+            },
+            [&](SlotMap_) {
+                return maxVertex;
             },
             [&](List_) {
                 return std::string_view("null");
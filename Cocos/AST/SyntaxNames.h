@@ -72,8 +72,10 @@ inline const char* getName(const Component& v) noexcept { return "Component"; }
 inline const char* getName(const VertexMap& v) noexcept { return "VertexMap"; }
 inline const char* getName(const Vector_& v) noexcept { return "Vector"; }
 inline const char* getName(const List_& v) noexcept { return "List"; }
+inline const char* getName(const SlotMap_& v) noexcept { return "SlotMap"; }
 inline const char* getName(const Set_& v) noexcept { return "Set"; }
 inline const char* getName(const MultiSet_& v) noexcept { return "MultiSet"; }
+inline const char* getName(const Pool_& v) noexcept { return "Pool"; }
 inline const char* getName(const Direct_& v) noexcept { return "Direct"; }
 inline const char* getName(const Trie_& v) noexcept { return "Trie"; }
 inline const char* getName(const Layer& v) noexcept { return "Layer"; }
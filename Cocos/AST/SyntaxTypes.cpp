@@ -36,11 +36,15 @@ Instance::Instance(const allocator_type& alloc) noexcept
 
 Instance::Instance(Instance&& rhs, const allocator_type& alloc)
     : mTemplate(std::move(rhs.mTemplate), alloc)
-    , mParameters(std::move(rhs.mParameters), alloc) {}
+    , mParameters(std::move(rhs.mParameters), alloc)
+    , mTemplateSymbol(std::move(rhs.mTemplateSymbol))
+    , mTemplateID(std::move(rhs.mTemplateID)) {}
 
 Instance::Instance(Instance const& rhs, const allocator_type& alloc)
     : mTemplate(rhs.mTemplate, alloc)
-    , mParameters(rhs.mParameters, alloc) {}
+    , mParameters(rhs.mParameters, alloc)
+    , mTemplateSymbol(rhs.mTemplateSymbol)
+    , mTemplateID(rhs.mTemplateID) {}
 
 Instance::~Instance() noexcept = default;
 
@@ -101,12 +105,16 @@ Base::Base(std::string_view typePath, bool virtualBase, bool implements, const a
 Base::Base(Base&& rhs, const allocator_type& alloc)
     : mTypePath(std::move(rhs.mTypePath), alloc)
     , mVirtualBase(std::move(rhs.mVirtualBase))
-    , mImplements(std::move(rhs.mImplements)) {}
+    , mImplements(std::move(rhs.mImplements))
+    , mTypeSymbol(std::move(rhs.mTypeSymbol))
+    , mTypeID(std::move(rhs.mTypeID)) {}
 
 Base::Base(Base const& rhs, const allocator_type& alloc)
     : mTypePath(rhs.mTypePath, alloc)
     , mVirtualBase(rhs.mVirtualBase)
-    , mImplements(rhs.mImplements) {}
+    , mImplements(rhs.mImplements)
+    , mTypeSymbol(rhs.mTypeSymbol)
+    , mTypeID(rhs.mTypeID) {}
 
 Base::~Base() noexcept = default;
 
@@ -200,7 +208,9 @@ Member::Member(Member&& rhs, const allocator_type& alloc)
     , mTypescriptType(std::move(rhs.mTypescriptType), alloc)
     , mTypescriptDefaultValue(std::move(rhs.mTypescriptDefaultValue), alloc)
     , mTypescriptArray(std::move(rhs.mTypescriptArray))
-    , mTypescriptOptional(std::move(rhs.mTypescriptOptional)) {}
+    , mTypescriptOptional(std::move(rhs.mTypescriptOptional))
+    , mTypeSymbol(std::move(rhs.mTypeSymbol))
+    , mTypeID(std::move(rhs.mTypeID)) {}
 
 Member::Member(Member const& rhs, const allocator_type& alloc)
     : mTypePath(rhs.mTypePath, alloc)
@@ -215,7 +225,9 @@ Member::Member(Member const& rhs, const allocator_type& alloc)
     , mTypescriptType(rhs.mTypescriptType, alloc)
     , mTypescriptDefaultValue(rhs.mTypescriptDefaultValue, alloc)
     , mTypescriptArray(rhs.mTypescriptArray)
-    , mTypescriptOptional(rhs.mTypescriptOptional) {}
+    , mTypescriptOptional(rhs.mTypescriptOptional)
+    , mTypeSymbol(rhs.mTypeSymbol)
+    , mTypeID(rhs.mTypeID) {}
 
 Member::~Member() noexcept = default;
 
@@ -234,7 +246,9 @@ Parameter::Parameter(Parameter&& rhs, const allocator_type& alloc)
     , mPointer(std::move(rhs.mPointer))
     , mReference(std::move(rhs.mReference))
     , mRvalue(std::move(rhs.mRvalue))
-    , mOptional(std::move(rhs.mOptional)) {}
+    , mOptional(std::move(rhs.mOptional))
+    , mTypeSymbol(std::move(rhs.mTypeSymbol))
+    , mTypeID(std::move(rhs.mTypeID)) {}
 
 Parameter::Parameter(Parameter const& rhs, const allocator_type& alloc)
     : mTypePath(rhs.mTypePath, alloc)
@@ -245,7 +259,9 @@ Parameter::Parameter(Parameter const& rhs, const allocator_type& alloc)
     , mPointer(rhs.mPointer)
     , mReference(rhs.mReference)
     , mRvalue(rhs.mRvalue)
-    , mOptional(rhs.mOptional) {}
+    , mOptional(rhs.mOptional)
+    , mTypeSymbol(rhs.mTypeSymbol)
+    , mTypeID(rhs.mTypeID) {}
 
 Parameter::~Parameter() noexcept = default;
 
@@ -367,14 +383,18 @@ PolymorphicPair::PolymorphicPair(PolymorphicPair&& rhs, const allocator_type& al
     , mValue(std::move(rhs.mValue), alloc)
     , mMemberName(std::move(rhs.mMemberName), alloc)
     , mContainerPath(std::move(rhs.mContainerPath), alloc)
-    , mVector(std::move(rhs.mVector)) {}
+    , mVector(std::move(rhs.mVector))
+    , mValueSymbol(std::move(rhs.mValueSymbol))
+    , mValueID(std::move(rhs.mValueID)) {}
 
 PolymorphicPair::PolymorphicPair(PolymorphicPair const& rhs, const allocator_type& alloc)
     : mTag(rhs.mTag, alloc)
     , mValue(rhs.mValue, alloc)
     , mMemberName(rhs.mMemberName, alloc)
     , mContainerPath(rhs.mContainerPath, alloc)
-    , mVector(rhs.mVector) {}
+    , mVector(rhs.mVector)
+    , mValueSymbol(rhs.mValueSymbol)
+    , mValueID(rhs.mValueID) {}
 
 PolymorphicPair::~PolymorphicPair() noexcept = default;
 
@@ -400,14 +420,18 @@ Component::Component(Component&& rhs, const allocator_type& alloc)
     , mValuePath(std::move(rhs.mValuePath), alloc)
     , mMemberName(std::move(rhs.mMemberName), alloc)
     , mContainerPath(std::move(rhs.mContainerPath), alloc)
-    , mVector(std::move(rhs.mVector)) {}
+    , mVector(std::move(rhs.mVector))
+    , mValueSymbol(std::move(rhs.mValueSymbol))
+    , mValueID(std::move(rhs.mValueID)) {}
 
 Component::Component(Component const& rhs, const allocator_type& alloc)
     : mName(rhs.mName, alloc)
     , mValuePath(rhs.mValuePath, alloc)
     , mMemberName(rhs.mMemberName, alloc)
     , mContainerPath(rhs.mContainerPath, alloc)
-    , mVector(rhs.mVector) {}
+    , mVector(rhs.mVector)
+    , mValueSymbol(rhs.mValueSymbol)
+    , mValueID(rhs.mValueID) {}
 
 Component::~Component() noexcept = default;
 
@@ -579,6 +603,12 @@ Graph::Graph(Graph&& rhs, const allocator_type& alloc)
     , mAddressIndex(std::move(rhs.mAddressIndex))
     , mMutableReference(std::move(rhs.mMutableReference))
     , mColorMap(std::move(rhs.mColorMap))
+    , mPackedColorMap(std::move(rhs.mPackedColorMap))
+    , mCsrFreeze(std::move(rhs.mCsrFreeze))
+    , mFragment(std::move(rhs.mFragment))
+    , mOrderedDag(std::move(rhs.mOrderedDag))
+    , mObjectRanges(std::move(rhs.mObjectRanges))
+    , mLevels(std::move(rhs.mLevels))
     , mPolymorphic(std::move(rhs.mPolymorphic), alloc)
     , mVertexListType(std::move(rhs.mVertexListType))
     , mEdgeListType(std::move(rhs.mEdgeListType))
@@ -621,6 +651,12 @@ Graph::Graph(Graph const& rhs, const allocator_type& alloc)
     , mAddressIndex(rhs.mAddressIndex)
     , mMutableReference(rhs.mMutableReference)
     , mColorMap(rhs.mColorMap)
+    , mPackedColorMap(rhs.mPackedColorMap)
+    , mCsrFreeze(rhs.mCsrFreeze)
+    , mFragment(rhs.mFragment)
+    , mOrderedDag(rhs.mOrderedDag)
+    , mObjectRanges(rhs.mObjectRanges)
+    , mLevels(rhs.mLevels)
     , mPolymorphic(rhs.mPolymorphic, alloc)
     , mVertexListType(rhs.mVertexListType)
     , mEdgeListType(rhs.mEdgeListType)
@@ -669,6 +705,33 @@ Comment::Comment(Comment const& rhs, const allocator_type& alloc)
 
 Comment::~Comment() noexcept = default;
 
+ModuleIndex::ModuleIndex(const allocator_type& alloc) noexcept
+    : mVertices(alloc)
+    , mMemberTemplates(alloc)
+    , mTemplates(alloc) {}
+
+ModuleIndex::ModuleIndex(ModuleIndex&& rhs, const allocator_type& alloc)
+    : mVertices(std::move(rhs.mVertices), alloc)
+    , mMemberTemplates(std::move(rhs.mMemberTemplates), alloc)
+    , mTemplates(std::move(rhs.mTemplates), alloc)
+    , mHasGraph(std::move(rhs.mHasGraph))
+    , mHasGraphSerialization(std::move(rhs.mHasGraphSerialization))
+    , mHasSmallEdgeList(std::move(rhs.mHasSmallEdgeList))
+    , mHasSlotMap(std::move(rhs.mHasSlotMap))
+    , mUsesHashCombine(std::move(rhs.mUsesHashCombine)) {}
+
+ModuleIndex::ModuleIndex(ModuleIndex const& rhs, const allocator_type& alloc)
+    : mVertices(rhs.mVertices, alloc)
+    , mMemberTemplates(rhs.mMemberTemplates, alloc)
+    , mTemplates(rhs.mTemplates, alloc)
+    , mHasGraph(rhs.mHasGraph)
+    , mHasGraphSerialization(rhs.mHasGraphSerialization)
+    , mHasSmallEdgeList(rhs.mHasSmallEdgeList)
+    , mHasSlotMap(rhs.mHasSlotMap)
+    , mUsesHashCombine(rhs.mUsesHashCombine) {}
+
+ModuleIndex::~ModuleIndex() noexcept = default;
+
 SyntaxGraph::allocator_type SyntaxGraph::get_allocator() const noexcept {
     return allocator_type(mVertices.get_allocator().resource());
 }
@@ -692,7 +755,11 @@ SyntaxGraph::SyntaxGraph(const allocator_type& alloc)
     , mGraphs(alloc)
     , mVariants(alloc)
     , mInstances(alloc)
-    , mPathIndex(alloc) {}
+    , mPathIndex(alloc)
+    , mModuleIndex(alloc)
+    , mSymbolIndex(alloc)
+    , mSymbols(alloc)
+    , mSymbolVertices(alloc) {}
 
 SyntaxGraph::SyntaxGraph(SyntaxGraph&& rhs, const allocator_type& alloc)
     : mObjects(std::move(rhs.mObjects), alloc)
@@ -714,7 +781,13 @@ SyntaxGraph::SyntaxGraph(SyntaxGraph&& rhs, const allocator_type& alloc)
     , mVariants(std::move(rhs.mVariants), alloc)
     , mInstances(std::move(rhs.mInstances), alloc)
     , mScratch(std::move(rhs.mScratch))
-    , mPathIndex(std::move(rhs.mPathIndex), alloc) {}
+    , mPathIndex(std::move(rhs.mPathIndex), alloc)
+    , mModuleIndex(std::move(rhs.mModuleIndex), alloc)
+    , mSymbolIndex(std::move(rhs.mSymbolIndex), alloc)
+    , mSymbols(std::move(rhs.mSymbols), alloc)
+    , mSymbolVertices(std::move(rhs.mSymbolVertices), alloc)
+    , mSymbolsBound(rhs.mSymbolsBound)
+    , mNameCache(std::move(rhs.mNameCache)) {}
 
 SyntaxGraph::SyntaxGraph(SyntaxGraph const& rhs, const allocator_type& alloc)
     : mObjects(rhs.mObjects, alloc)
@@ -736,7 +809,13 @@ SyntaxGraph::SyntaxGraph(SyntaxGraph const& rhs, const allocator_type& alloc)
     , mVariants(rhs.mVariants, alloc)
     , mInstances(rhs.mInstances, alloc)
     , mScratch(rhs.mScratch)
-    , mPathIndex(rhs.mPathIndex, alloc) {}
+    , mPathIndex(rhs.mPathIndex, alloc)
+    , mModuleIndex(rhs.mModuleIndex, alloc)
+    , mSymbolIndex(rhs.mSymbolIndex, alloc)
+    , mSymbols(rhs.mSymbols, alloc)
+    , mSymbolVertices(rhs.mSymbolVertices, alloc)
+    , mSymbolsBound(rhs.mSymbolsBound)
+    , mNameCache(rhs.mNameCache) {}
 
 SyntaxGraph::SyntaxGraph(SyntaxGraph&& rhs) = default;
 SyntaxGraph& SyntaxGraph::operator=(SyntaxGraph&& rhs) = default;
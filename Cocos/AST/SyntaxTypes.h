@@ -25,6 +25,7 @@ THE SOFTWARE.
 */
 
 #pragma once
+#include <Cocos/AST/NameCache.h>
 #include <Cocos/AST/SyntaxFwd.h>
 #include <Cocos/GraphTypes.h>
 
@@ -89,6 +90,11 @@ constexpr bool any(GenerationFlags e) noexcept {
 struct Container {};
 struct Map {};
 
+// Interned type path, see SyntaxGraph::intern
+enum class SymbolID : uint32_t {
+    Invalid = 0xFFFFFFFF,
+};
+
 struct Instance {
     using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
     allocator_type get_allocator() const noexcept {
@@ -107,6 +113,8 @@ struct Instance {
 
     std::pmr::string mTemplate;
     std::pmr::vector<std::pmr::string> mParameters;
+    SymbolID mTemplateSymbol = SymbolID::Invalid;
+    uint32_t mTemplateID = std::numeric_limits<uint32_t>::max();
 };
 
 struct Namespace {};
@@ -192,6 +200,8 @@ struct Base {
     std::pmr::string mTypePath;
     bool mVirtualBase = false;
     bool mImplements = false;
+    SymbolID mTypeSymbol = SymbolID::Invalid;
+    uint32_t mTypeID = std::numeric_limits<uint32_t>::max();
 };
 
 struct Inherits {
@@ -331,6 +341,8 @@ struct Member {
     std::pmr::string mTypescriptDefaultValue;
     bool mTypescriptArray = false;
     bool mTypescriptOptional = false;
+    SymbolID mTypeSymbol = SymbolID::Invalid;
+    uint32_t mTypeID = std::numeric_limits<uint32_t>::max();
 };
 
 struct Parameter {
@@ -374,6 +386,8 @@ struct Parameter {
     bool mReference = false;
     bool mRvalue = false;
     bool mOptional = false;
+    SymbolID mTypeSymbol = SymbolID::Invalid;
+    uint32_t mTypeID = std::numeric_limits<uint32_t>::max();
 };
 
 enum class Doc : uint32_t {
@@ -566,6 +580,8 @@ struct PolymorphicPair {
     std::pmr::string mMemberName;
     std::pmr::string mContainerPath;
     bool mVector = true;
+    SymbolID mValueSymbol = SymbolID::Invalid;
+    uint32_t mValueID = std::numeric_limits<uint32_t>::max();
 };
 
 struct Polymorphic {
@@ -626,6 +642,8 @@ struct Component {
     std::pmr::string mMemberName;
     std::pmr::string mContainerPath;
     bool mVector = true;
+    SymbolID mValueSymbol = SymbolID::Invalid;
+    uint32_t mValueID = std::numeric_limits<uint32_t>::max();
 };
 
 struct VertexMap {
@@ -663,8 +681,16 @@ struct Vector_ {};
 struct List_ {};
 struct Set_ {};
 struct MultiSet_ {};
+// vector with inline storage, the allocator is only used beyond mCapacity elements
+struct SmallVector_ {
+    uint32_t mCapacity = 4;
+};
+// vector whose removed slots are recycled, descriptors of other vertices stay valid
+struct SlotMap_ {};
+// edges stored in fixed-size blocks, erased slots are reused and edge addresses stay stable
+struct Pool_ {};
 
-using VertexListType = std::variant<Vector_, List_>;
+using VertexListType = std::variant<Vector_, List_, SlotMap_>;
 
 inline bool operator<(const VertexListType& lhs, const VertexListType& rhs) noexcept {
     return lhs.index() < rhs.index();
@@ -677,7 +703,7 @@ inline bool operator==(const VertexListType& lhs, const VertexListType& rhs) noe
 inline bool operator!=(const VertexListType& lhs, const VertexListType& rhs) noexcept {
     return !(lhs == rhs);
 }
-using EdgeListType = std::variant<List_, Set_, MultiSet_>;
+using EdgeListType = std::variant<List_, Set_, MultiSet_, Pool_>;
 
 inline bool operator<(const EdgeListType& lhs, const EdgeListType& rhs) noexcept {
     return lhs.index() < rhs.index();
@@ -690,7 +716,7 @@ inline bool operator==(const EdgeListType& lhs, const EdgeListType& rhs) noexcep
 inline bool operator!=(const EdgeListType& lhs, const EdgeListType& rhs) noexcept {
     return !(lhs == rhs);
 }
-using OutEdgeListType = std::variant<Vector_, List_, Set_, MultiSet_>;
+using OutEdgeListType = std::variant<Vector_, List_, Set_, MultiSet_, SmallVector_>;
 
 inline bool operator<(const OutEdgeListType& lhs, const OutEdgeListType& rhs) noexcept {
     return lhs.index() < rhs.index();
@@ -707,7 +733,7 @@ inline bool operator!=(const OutEdgeListType& lhs, const OutEdgeListType& rhs) n
 struct Direct_ {};
 struct Trie_ {};
 
-using PathIndexType = std::variant<Direct_, Map_>;
+using PathIndexType = std::variant<Direct_, Map_, Trie_>;
 
 inline bool operator<(const PathIndexType& lhs, const PathIndexType& rhs) noexcept {
     return lhs.index() < rhs.index();
@@ -883,13 +909,26 @@ struct Graph {
     }
 
     bool isVector() const noexcept {
-        return holds_alternative<Vector_>(mVertexListType);
+        return holds_alternative<Vector_>(mVertexListType) || isSlotMap();
+    }
+
+    bool isSlotMap() const noexcept {
+        return holds_alternative<SlotMap_>(mVertexListType);
     }
 
     bool isEdgeListVector() const noexcept {
         return false;
     }
 
+    bool hasSmallEdgeList() const noexcept {
+        return holds_alternative<SmallVector_>(mOutEdgeListType);
+    }
+
+    uint32_t getSmallEdgeListCapacity() const noexcept {
+        Expects(hasSmallEdgeList());
+        return std::get<SmallVector_>(mOutEdgeListType).mCapacity;
+    }
+
     bool isDirectedOnly() const noexcept {
         return !mUndirected && !mBidirectional;
     }
@@ -958,9 +997,39 @@ struct Graph {
     bool hasAddressIndex() const noexcept {
         return mAddressable && mAddressIndex;
     }
+    bool hasPathTrie() const noexcept {
+        return hasAddressIndex() && holds_alternative<Trie_>(mAddressableConcept.mType);
+    }
     bool hasIteratorComponent() const noexcept {
         return !isVector();
     }
+    // Frozen arrays copy the stored edges, so edges must not own properties
+    // or refer to an edge list.
+    bool isFreezable() const noexcept {
+        return mIncidence && isVector()
+            && (holds_alternative<Vector_>(mOutEdgeListType) || hasSmallEdgeList())
+            && !hasEdgeProperty() && !needEdgeList();
+    }
+    // Batched removal retargets the stored edges in place, with the same limits.
+    // Slot maps keep their descriptors, and remove vertices one by one.
+    bool hasCompactingRemoval() const noexcept {
+        return isSlotMap() || isFreezable();
+    }
+    // fragments are appended with shifted descriptors, so slots and edge objects are not supported
+    bool isMergeable() const noexcept {
+        return isFreezable() && !isSlotMap();
+    }
+    // packed colors are indexed by descriptor, like the color map
+    bool hasPackedColorMap() const noexcept {
+        return mPackedColorMap && isVector() && mColorMap;
+    }
+    bool hasLevels() const noexcept {
+        return mLevels;
+    }
+    // objects stored in vectors keep the vertex holding them
+    bool hasObjectVertices(const PolymorphicPair& c) const noexcept {
+        return mObjectRanges && !c.isIntrusive() && c.isVector();
+    }
     const Component& getComponent(std::string_view name) const {
         for (const auto& c : mComponents) {
             if (c.mName == name) {
@@ -1009,6 +1078,12 @@ struct Graph {
     bool mAddressIndex = true;
     bool mMutableReference = true;
     bool mColorMap = true;
+    bool mPackedColorMap = true;
+    bool mCsrFreeze = false;
+    bool mFragment = false;
+    bool mOrderedDag = false;
+    bool mObjectRanges = false;
+    bool mLevels = false;
     Polymorphic mPolymorphic;
     VertexListType mVertexListType;
     EdgeListType mEdgeListType;
@@ -1076,6 +1151,32 @@ struct Comment {
     PmrMap<std::pmr::string, std::pmr::string> mParameterComments;
 };
 
+struct ModuleIndex {
+    using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
+    allocator_type get_allocator() const noexcept {
+        return allocator_type(mVertices.get_allocator().resource());
+    }
+
+    ModuleIndex(const allocator_type& alloc) noexcept;
+    ModuleIndex(ModuleIndex&& rhs, const allocator_type& alloc);
+    ModuleIndex(ModuleIndex const& rhs, const allocator_type& alloc);
+
+    ModuleIndex(ModuleIndex&& rhs) = default;
+    ModuleIndex(ModuleIndex const& rhs) = delete;
+    ModuleIndex& operator=(ModuleIndex&& rhs) = default;
+    ModuleIndex& operator=(ModuleIndex const& rhs) = default;
+    ~ModuleIndex() noexcept;
+
+    std::pmr::vector<uint32_t> mVertices;
+    PmrSet<std::pmr::string> mMemberTemplates;
+    PmrSet<std::pmr::string> mTemplates;
+    bool mHasGraph = false;
+    bool mHasGraphSerialization = false;
+    bool mHasSmallEdgeList = false;
+    bool mHasSlotMap = false;
+    bool mUsesHashCombine = false;
+};
+
 struct SyntaxGraph {
     using allocator_type = std::pmr::polymorphic_allocator<std::byte>;
     allocator_type get_allocator() const noexcept;
@@ -1157,6 +1258,12 @@ struct SyntaxGraph {
     [[nodiscard]] inline std::pmr::vector<boost::default_color_type> colors(std::pmr::memory_resource* mr) const {
         return std::pmr::vector<boost::default_color_type>{ mVertices.size(), mr };
     }
+    [[nodiscard]] inline Impl::PackedColors packedColors(std::pmr::memory_resource* mr) const {
+        return Impl::PackedColors{ mVertices.size(), mr };
+    }
+    [[nodiscard]] inline Impl::VisitedBitset visitedBitset(std::pmr::memory_resource* mr) const {
+        return Impl::VisitedBitset{ mVertices.size(), mr };
+    }
 
     // EdgeListGraph
     using edge_iterator = Impl::DirectedEdgeIterator<vertex_iterator, out_edge_iterator, SyntaxGraph>;
@@ -1278,6 +1385,22 @@ struct SyntaxGraph {
     std::pmr::string getDependentCppName(std::string_view ns, vertex_descriptor vertID,
         std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const;
 
+    // Views into the name cache of a compiled graph, valid until the graph is mutated.
+    std::string_view getCachedTypePath(std::string_view currentScope, std::string_view dependentName,
+        std::pmr::memory_resource* scratch) const;
+    std::string_view getCachedDependentName(std::string_view ns, vertex_descriptor vertID,
+        std::pmr::memory_resource* scratch) const;
+    std::string_view getCachedDependentCppName(std::string_view ns, vertex_descriptor vertID,
+        std::pmr::memory_resource* scratch) const;
+
+    // Resolve without the name cache, so that each lookup is counted once.
+    std::pmr::string getTypePathUncached(std::string_view currentScope, std::string_view dependentName,
+        std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const;
+    std::pmr::string getDependentNameUncached(std::string_view ns, vertex_descriptor vertID,
+        std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const;
+    std::pmr::string getDependentCppNameUncached(std::string_view ns, vertex_descriptor vertID,
+        std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const;
+
     vertex_descriptor lookupType(std::string_view currentScope, std::string_view dependentName,
         std::pmr::memory_resource* scratch) const;
 
@@ -1301,11 +1424,20 @@ struct SyntaxGraph {
 
     bool moduleHasGraph(std::string_view modulePath) const;
     bool moduleHasGraphSerialization(std::string_view modulePath) const;
+    bool moduleHasSmallEdgeList(std::string_view modulePath) const;
+    bool moduleHasSlotMap(std::string_view modulePath) const;
 
     bool moduleUsesHashCombine(std::string_view modulePath) const;
 
     bool moduleHasImpl(std::string_view modulePath, bool bDLL) const;
 
+    void buildModuleIndex();
+    std::span<const vertex_descriptor> getModuleVertices(std::string_view modulePath) const noexcept;
+
+    // Symbols
+    SymbolID intern(std::string_view typePath);
+    void bindSymbols();
+
     // Typescript
     bool isTypescriptData(std::string_view name) const;
     bool isTypescriptValueType(vertex_descriptor vertID) const;
@@ -1324,6 +1456,12 @@ struct SyntaxGraph {
     std::pmr::string getTypescriptTypename(std::string_view typePath,
         std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const;
 
+    // View into the name cache of a compiled graph, valid until the graph is mutated.
+    std::string_view getCachedTypescriptTypename(vertex_descriptor vertID,
+        std::pmr::memory_resource* scratch) const;
+    std::pmr::string getTypescriptTypenameUncached(vertex_descriptor vertID,
+        std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const;
+
     std::pmr::string getTypescriptTagName(vertex_descriptor vertID,
         std::pmr::memory_resource* mr, std::pmr::memory_resource* scratch) const;
 
@@ -1427,6 +1565,16 @@ struct SyntaxGraph {
     std::pmr::memory_resource* mScratch = nullptr;
     // Path
     PmrMap<std::pmr::string, uint32_t> mPathIndex;
+    // Module
+    PmrMap<std::pmr::string, ModuleIndex> mModuleIndex;
+    // Symbols
+    PmrUnorderedStringMap<std::pmr::string, SymbolID> mSymbolIndex;
+    std::pmr::vector<std::pmr::string> mSymbols;
+    std::pmr::vector<vertex_descriptor> mSymbolVertices;
+    // bound ids are descriptors, removing a vertex unbinds them until bindSymbols runs again
+    bool mSymbolsBound = false;
+    // Names
+    NameCache mNameCache;
 };
 
 enum Features : uint32_t {
@@ -1574,6 +1722,12 @@ struct ModuleGraph {
     [[nodiscard]] inline std::pmr::vector<boost::default_color_type> colors(std::pmr::memory_resource* mr) const {
         return std::pmr::vector<boost::default_color_type>{ mVertices.size(), mr };
     }
+    [[nodiscard]] inline Impl::PackedColors packedColors(std::pmr::memory_resource* mr) const {
+        return Impl::PackedColors{ mVertices.size(), mr };
+    }
+    [[nodiscard]] inline Impl::VisitedBitset visitedBitset(std::pmr::memory_resource* mr) const {
+        return Impl::VisitedBitset{ mVertices.size(), mr };
+    }
 
     // EdgeListGraph
     using edge_iterator = Impl::DirectedEdgeIterator<vertex_iterator, out_edge_iterator, ModuleGraph>;
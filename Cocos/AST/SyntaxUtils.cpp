@@ -28,6 +28,25 @@ THE SOFTWARE.
 
 namespace Cocos::Meta {
 
+namespace {
+
+thread_local std::pmr::memory_resource* sThreadScratch = nullptr;
+
+}
+
+std::pmr::memory_resource* getThreadScratch(std::pmr::memory_resource* scratch) noexcept {
+    return sThreadScratch ? sThreadScratch : scratch;
+}
+
+ThreadScratchScope::ThreadScratchScope(std::pmr::memory_resource* scratch) noexcept
+    : mPrevious(sThreadScratch) {
+    sThreadScratch = scratch;
+}
+
+ThreadScratchScope::~ThreadScratchScope() noexcept {
+    sThreadScratch = mPrevious;
+}
+
 size_t findEndMatch(std::string_view str, const char left, const char right, size_t pos) {
     int count = 0;
     Expects(pos < str.size());
@@ -562,6 +581,17 @@ std::pmr::string getTagVariableName(std::string_view typeName,
     return getVariableName(name, mr);
 }
 
+// "/cc/render/RasterPass_" -> "mRasterPassVertices"
+std::pmr::string getObjectVerticesName(std::string_view tagPath,
+    std::pmr::memory_resource* mr) {
+    const auto pos = tagPath.find_last_of('/');
+    const auto tagName = pos == tagPath.npos ? tagPath : tagPath.substr(pos + 1);
+    std::pmr::string name("m", mr);
+    name.append(convertTag(tagName));
+    name.append("Vertices");
+    return name;
+}
+
 std::pmr::string getRelativePath(std::string_view current0, std::string_view target0,
     std::pmr::memory_resource* mr) {
     auto currentFile = current0.find_last_of('/');
@@ -28,6 +28,20 @@ THE SOFTWARE.
 
 namespace Cocos::Meta {
 
+// Memory
+std::pmr::memory_resource* getThreadScratch(std::pmr::memory_resource* scratch) noexcept;
+
+// Overrides the scratch resource of the calling thread until the scope ends,
+// so that code generation can run on worker threads without sharing a pool.
+struct ThreadScratchScope {
+    explicit ThreadScratchScope(std::pmr::memory_resource* scratch) noexcept;
+    ThreadScratchScope(const ThreadScratchScope&) = delete;
+    ThreadScratchScope& operator=(const ThreadScratchScope&) = delete;
+    ~ThreadScratchScope() noexcept;
+
+    std::pmr::memory_resource* mPrevious = nullptr;
+};
+
 // Basics
 size_t findEndMatch(std::string_view str, const char left, const char right, size_t pos);
 size_t findBegMatch(std::string_view str, const char left, const char right, size_t pos);
@@ -105,6 +119,9 @@ std::pmr::string getTypescriptTagType(std::string_view tagName,
 std::pmr::string getTagVariableName(std::string_view typeName,
     std::pmr::memory_resource* mr);
 
+std::pmr::string getObjectVerticesName(std::string_view tagPath,
+    std::pmr::memory_resource* mr);
+
 std::pmr::string getRelativePath(std::string_view current, std::string_view target,
     std::pmr::memory_resource* mr);
 
@@ -6,12 +6,13 @@
 namespace Cocos::Meta {
 
 std::pmr::string generateToJsIni(const ModuleBuilder& builder, uint32_t moduleID) {
-    auto scratch = builder.mScratch;
-    pmr_ostringstream oss(std::ios::out, scratch);
+    auto scratch = getThreadScratch(builder.mScratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     const auto& g = builder.mSyntaxGraph;
     const auto& mg = builder.mModuleGraph;
+    const auto modulePath = get_path(moduleID, mg, scratch);
 
     const auto& m = get(mg.modules, mg, moduleID);
 
@@ -57,7 +58,6 @@ extra_arguments = %(android_headers)s %(clang_headers)s %(cxxgenerator_headers)s
     oss << "\n";
     OSS << "cpp_headers =" << m.mToJsCppHeaders;
     {
-        auto modulePath = get_path(moduleID, mg, scratch);
         auto imported = g.getImportedTypes(modulePath, scratch);
         for (const auto& [depPath, types] : imported) {
             auto depID = locate(depPath, mg);
@@ -89,12 +89,7 @@ replace_headers =
 
     OSS << "classes =";
     auto outputNames = [&](bool bInterface) {
-        for (const auto& vertID : make_range(vertices(g))) {
-            const auto& modulePath = get(g.modulePaths, g, vertID);
-            auto moduleID1 = locate(modulePath, mg);
-            if (moduleID1 != moduleID)
-                continue;
-
+        for (const auto& vertID : g.getModuleVertices(modulePath)) {
             const auto& traits = get(g.traits, g, vertID);
 
             if (traits.mImport)
@@ -120,7 +115,7 @@ replace_headers =
     };
 
     auto outputMethods = [&](SyntaxGraph::vertex_descriptor vertID, bool convert, auto comp) -> std::pmr::string {
-        pmr_ostringstream oss(std::ios_base::out, scratch);
+        CodeStream oss(scratch);
 
         const auto& name = get(g.names, g, vertID);
         visit_vertex(
@@ -161,7 +156,7 @@ replace_headers =
             [&](const auto&) {
 
             });
-        return oss.str();
+        return oss.release();
     };
 
     outputNames(false);
@@ -181,12 +176,7 @@ classes_need_extend =
     {
         OSS << "skip =";
         int count = 0;
-        for (const auto& vertID : make_range(vertices(g))) {
-            const auto& modulePath = get(g.modulePaths, g, vertID);
-            auto moduleID1 = locate(modulePath, mg);
-            if (moduleID1 != moduleID)
-                continue;
-
+        for (const auto& vertID : g.getModuleVertices(modulePath)) {
             const auto& traits = get(g.traits, g, vertID);
 
             if (traits.mImport)
@@ -217,12 +207,7 @@ skip_public_fields =
     OSS << "getter_setter =";
     {
         int count = 0;
-        for (const auto& vertID : make_range(vertices(g))) {
-            const auto& modulePath = get(g.modulePaths, g, vertID);
-            auto moduleID1 = locate(modulePath, mg);
-            if (moduleID1 != moduleID)
-                continue;
-
+        for (const auto& vertID : g.getModuleVertices(modulePath)) {
             const auto& traits = get(g.traits, g, vertID);
 
             if (traits.mImport)
@@ -282,7 +267,7 @@ classes_owned_by_cpp =
 obtain_return_value =
 )";
     copyString(oss, space, m.mToJsConfigs);
-    return oss.str();
+    return oss.release();
 }
 
 }
@@ -134,7 +134,7 @@ void outputTypescript(std::ostream& oss, std::pmr::string& space,
             }
             const auto& inherits = get(g.inherits, g, vertID);
             for (int count = 0; const auto& base : inherits.mBases) {
-                auto superID = locate(base.mTypePath, g);
+                auto superID = locate(base, g);
                 const auto& traits = get(g.traits, g, superID);
                 if (traits.mFlags & IMPL_DETAIL) {
                     continue;
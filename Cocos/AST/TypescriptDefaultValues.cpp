@@ -31,6 +31,7 @@ THE SOFTWARE.
 namespace Cocos::Meta {
 
 void projectTypescriptDefaultValues(ModuleBuilder& builder) {
+    PROFILE_SCOPE(__func__);
     PROJECT_TS(bool, boolean);
     PROJECT_TS(int, number);
     PROJECT_TS(float, number);
@@ -130,6 +131,7 @@ void projectTypescriptDefaultValues(ModuleBuilder& builder) {
     PROJECT_TS(cc::UnorderedStringMultiMap, Map);
     PROJECT_TS(cc::PmrUnorderedStringMap, Map);
     PROJECT_TS(cc::PmrUnorderedStringMultiMap, Map);
+    PROJECT_TS(cc::PmrFrozenStringMap, Map);
 
     PROJECT_TS(cc::TransparentSet, Set);
     PROJECT_TS(cc::TransparentMultiSet, Set);
@@ -41,7 +41,7 @@ std::pmr::string generatePushIndicenceList(const Graph& g,
     std::string_view el, std::string_view outEdgeType,
     std::string_view v, std::string_view edge,
     std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     if (edge.empty()) {
@@ -50,7 +50,7 @@ std::pmr::string generatePushIndicenceList(const Graph& g,
         OSS << el << ".push(new " << outEdgeType << "(" << v << ", " << edge << "));\n";
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 std::string generateAddEdge(const Graph* ptr, std::string_view name,
@@ -243,7 +243,10 @@ void outputNullVertex(std::ostream& oss, std::pmr::string& space,
     visit(
         overload(
             [&](Vector_) {
-                oss << "return 0xFFFFFFFF;";
+                oss << "return " << s.getTypescriptNullVertex() << ";";
+            },
+            [&](SlotMap_) {
+                oss << "return " << s.getTypescriptNullVertex() << ";";
             },
             [&](List_) {
                 oss << "return null;";
@@ -535,7 +538,11 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
     std::pmr::memory_resource* scratch) {
     const auto& g = builder.mSyntaxGraph;
 
-    pmr_ostringstream oss(std::ios_base::out, scratch);
+    if (s.mVertexDescriptor == "uint64_t") {
+        throw std::invalid_argument("DESCRIPTOR_TYPE: uint64_t null vertex is not representable in typescript");
+    }
+
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
 
     auto epID = locate(s.mEdgeProperty, g);
@@ -614,7 +621,7 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
         imports.emplace(inRefIter);
     }
 
-    const bool bVectorVertexDescriptor = holds_alternative<Vector_>(s.mVertexListType);
+    const bool bVectorVertexDescriptor = s.isVector();
 
     OSS << "//=================================================================\n";
     OSS << "// " << name << "\n";
@@ -748,7 +755,7 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
             for (const auto& c : s.mComponents) {
                 if (count++)
                     oss << "\n";
-                auto vertID = locate(c.mValuePath, g);
+                auto vertID = locate(c, g);
                 auto componentType = g.getTypescriptTypename(vertID, scratch, scratch);
                 Expects(!c.mMemberName.empty());
                 auto member = g.getMemberName(c.mMemberName, true);
@@ -886,7 +893,7 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
             Expects(s.mVertexMaps.size() == 1);
             const auto& map = s.mVertexMaps.front();
             const auto keyID = locate(map.mKeyType, g);
-            const auto keyType = g.getTypescriptTypename(keyID, scratch, scratch);
+            const auto keyType = g.getCachedTypescriptTypename(keyID, scratch);
             oss << "\n";
             if (gImpl) {
                 OSS << ", impl.UuidGraph<" << keyType << ">";
@@ -1174,7 +1181,7 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
                         OSS << "// Members\n";
                     }
 
-                    const auto memberID = locate(m.mTypePath, g);
+                    const auto memberID = locate(m, g);
                     auto memberName = g.getMemberName(m.mMemberName, true);
 
                     if (bSkip) {
@@ -1230,6 +1237,11 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
                     ++numCleared;
                 }
 
+                // AddressableGraph (Trie), native only
+                if (s.hasPathTrie()) {
+                    ++numCleared;
+                }
+
                 // Graph Edges
                 if (s.needEdgeList()) {
                     OSS << "// Graph Edges\n";
@@ -1237,6 +1249,28 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
                     ++numCleared;
                 }
 
+                // FrozenGraph, native only
+                if (s.mCsrFreeze) {
+                    numCleared += s.mBidirectional ? 4 : 2;
+                }
+
+                // OrderedDag, native only
+                if (s.mOrderedDag) {
+                    numCleared += 2;
+                }
+
+                // ObjectRanges, native only
+                for (const auto& c : s.mPolymorphic.mConcepts) {
+                    if (s.hasObjectVertices(c)) {
+                        ++numCleared;
+                    }
+                }
+
+                // SlotMap, native only
+                if (s.isSlotMap()) {
+                    numCleared += s.isPolymorphic() ? 3 : 2;
+                }
+
                 // ComponentGraph
                 if (s.isVector()) {
                     OSS << "// ComponentGraph\n";
@@ -1819,7 +1853,7 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
 
             if (true) {
                 for (const auto& c : s.mComponents) {
-                    const auto componentID = locate(c.mValuePath, g);
+                    const auto componentID = locate(c, g);
                     auto componentType = c.getTypescriptComponentType(g, scratch, scratch);
                     auto member = g.getMemberName(c.mMemberName, false);
                     auto bNeedNameSetter = !(s.mNamedConcept.mComponent && s.mNamedConcept.mComponentName == c.mName && s.mAddressable);
@@ -2403,7 +2437,7 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
             Expects(s.mVertexMaps.size() == 1);
             const auto& map = s.mVertexMaps.front();
             const auto keyID = locate(map.mKeyType, g);
-            const auto keyType = g.getTypescriptTypename(keyID, scratch, scratch);
+            const auto keyType = g.getCachedTypescriptTypename(keyID, scratch);
 
             OSS << "//-----------------------------------------------------------------\n";
             OSS << "// UuidGraph\n";
@@ -2457,7 +2491,7 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
             if (s.isVector()) {
                 for (const auto& c : s.mComponents) {
                     Expects(!c.mMemberName.empty());
-                    auto vertID = locate(c.mValuePath, g);
+                    auto vertID = locate(c, g);
                     OSS << "readonly " << g.getMemberName(c.mMemberName, false)
                         << ": " << c.getTypescriptComponentType(g, scratch, scratch)
                         << "[] = [];\n";
@@ -2468,8 +2502,6 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
         if (!s.mVertexMaps.empty()) {
             Expects(s.mVertexMaps.size() == 1);
             const auto& map = s.mVertexMaps.front();
-            const auto keyID = locate(map.mKeyType, g);
-            const auto keyType = g.getTypescriptTypename(keyID, scratch, scratch);
             auto componentID = locate(map.mComponentName, g);
             const auto member = g.getMemberName(map.mMemberName, false);
             std::pmr::string mapType(scratch);
@@ -2481,8 +2513,8 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
             auto ns = g.getScope(vertID, scratch);
             auto mapID = g.lookupType(ns, mapType, scratch);
             Expects(mapID != g.null_vertex());
-            OSS << "readonly " << member << ": " << g.getTypescriptTypename(mapID, scratch, scratch)
-                << " = new " << g.getTypescriptTypename(mapID, scratch, scratch) << "();\n";
+            OSS << "readonly " << member << ": " << g.getCachedTypescriptTypename(mapID, scratch)
+                << " = new " << g.getCachedTypescriptTypename(mapID, scratch) << "();\n";
         }
 
         // GraphMembers
@@ -2498,7 +2530,7 @@ std::pmr::string generateGraph(const ModuleBuilder& builder,
         Ensures(imports.empty());
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 }
@@ -57,7 +57,7 @@ void outputContainer(std::ostream& oss, std::pmr::string& space,
             }
         }
         OSS << "}\n";
-    } else if (g.isTypescriptArray(paramID, g.get_allocator().resource())) {
+    } else if (g.isTypescriptArray(paramID, getThreadScratch(g.get_allocator().resource()))) {
         OSS << "for (const v" << level << " of ";
         if (level == 1) {
             oss << "v";
@@ -197,7 +197,7 @@ void outputMembers(std::ostream& oss, std::pmr::string& space,
                 for (uint32_t i = 0; const auto& m : members) {
                     if (i == id) {
                         outputComma();
-                        auto memberID = locate(m.mTypePath, g);
+                        auto memberID = locate(m, g);
                         auto memberType = g.getTypescriptTypename(memberID, scratch, scratch);
                         if (cntr.mHasDefault) {
                             oss << builder.getTypedMemberName(m, true);
@@ -257,7 +257,7 @@ void outputMembers(std::ostream& oss, std::pmr::string& space,
                         for (int count = 0; const auto& id : cntr.mIndices) {
                             for (uint32_t i = 0; const auto& m : members) {
                                 if (i == id) {
-                                    auto memberID = locate(m.mTypePath, g);
+                                    auto memberID = locate(m, g);
                                     if (count++)
                                         oss << ", ";
                                     oss << g.getMemberName(m.mMemberName, true);
@@ -273,7 +273,7 @@ void outputMembers(std::ostream& oss, std::pmr::string& space,
             for (uint32_t i = 0; const auto& m : members) {
                 for (const auto& id : cntr.mIndices) {
                     if (i == id) {
-                        auto memberID = locate(m.mTypePath, g);
+                        auto memberID = locate(m, g);
                         OSS << "this." << g.getMemberName(m.mMemberName, m.mPublic)
                             << " = " << g.getMemberName(m.mMemberName, true) << ";\n";
                     }
@@ -344,7 +344,7 @@ void outputMembers(std::ostream& oss, std::pmr::string& space,
                 }            
             }
 
-            auto paramID = locate(param.mTypePath, g);
+            auto paramID = locate(param, g);
             oss << param.name();
             if (!param.mDefaultValue.empty()) {
                 oss << "?";
@@ -438,7 +438,7 @@ void outputSaveSerializable(std::ostream& oss, std::pmr::string& space, std::str
     std::pmr::memory_resource* scratch) {
     if (g.isTypescriptPointer(vertID)) {
         OSS << "// skip, " << varName << ": "
-            << g.getTypescriptTypename(vertID, scratch, scratch) << "\n";
+            << g.getCachedTypescriptTypename(vertID, scratch) << "\n";
         return;
     }
     const auto& traits = get(g.traits, g, vertID);
@@ -463,7 +463,7 @@ void outputSaveSerializable(std::ostream& oss, std::pmr::string& space, std::str
         }
     } else {
         OSS << "// skip: " << varName << ": "
-            << g.getTypescriptTypename(vertID, scratch, scratch) << "\n";
+            << g.getCachedTypescriptTypename(vertID, scratch) << "\n";
     }
 }
 
@@ -475,10 +475,10 @@ void outputSaveCollection(std::ostream& oss, std::pmr::string& space, std::strin
     ++depth;
     if (g.isTypescriptSet(vertID)) {
         OSS << "ar.writeNumber(" << varName << ".size); // "
-            << g.getTypescriptTypename(vertID, scratch, scratch) << "\n";
+            << g.getCachedTypescriptTypename(vertID, scratch) << "\n";
     } else {
         OSS << "ar.writeNumber(" << varName << ".length); // "
-            << g.getTypescriptTypename(vertID, scratch, scratch) << "\n";
+            << g.getCachedTypescriptTypename(vertID, scratch) << "\n";
     }
     OSS << "for (const v" << depth << " of " << varName << ") {\n";
     {
@@ -501,7 +501,7 @@ void outputSaveMap(std::ostream& oss, std::pmr::string& space, std::string_view
     std::pmr::memory_resource* scratch) {
     ++depth;
     OSS << "ar.writeNumber(" << varName << ".size); // "
-        << g.getTypescriptTypename(vertID, scratch, scratch) << "\n";
+        << g.getCachedTypescriptTypename(vertID, scratch) << "\n";
     OSS << "for (const [k" << depth << ", v" << depth << "] of " << varName << ") {\n";
     {
         INDENT();
@@ -541,7 +541,7 @@ void outputLoadSerializable(std::ostream& oss, std::pmr::string& space, std::str
     std::pmr::memory_resource* scratch) {
     if (g.isTypescriptPointer(vertID)) {
         OSS << "// skip, " << varName << ": "
-            << g.getTypescriptTypename(vertID, scratch, scratch) << "\n";
+            << g.getCachedTypescriptTypename(vertID, scratch) << "\n";
         return;
     }
     const auto& traits = get(g.traits, g, vertID);
@@ -560,7 +560,7 @@ void outputLoadSerializable(std::ostream& oss, std::pmr::string& space, std::str
         OSS << "load" << memberName << "(ar, " << varName << ");\n";
     } else {
         OSS << "// skip: " << varName << ": "
-            << g.getTypescriptTypename(vertID, scratch, scratch) << "\n";
+            << g.getCachedTypescriptTypename(vertID, scratch) << "\n";
     }
 }
 
@@ -575,11 +575,11 @@ void outputLoadCollection(std::ostream& oss, std::pmr::string& space, std::strin
     std::pmr::string sizeName("sz", scratch);
     if (depth == 1) {
         OSS << sizeName << " = ar.readNumber(); // "
-            << g.getTypescriptTypename(vertID, scratch, scratch) << "\n";
+            << g.getCachedTypescriptTypename(vertID, scratch) << "\n";
     } else {
         sizeName.append(std::to_string(depth));
         OSS << "const " << sizeName << " = ar.readNumber(); // "
-            << g.getTypescriptTypename(vertID, scratch, scratch) << "\n";
+            << g.getCachedTypescriptTypename(vertID, scratch) << "\n";
     }
 
     // elememt
@@ -619,7 +619,7 @@ void outputLoadCollection(std::ostream& oss, std::pmr::string& space, std::strin
             outputLoadSerializable(oss, space, ns, g, paramID, lhsName, depth, scratch);
         } else {
             OSS << "const " << paramName << " = new "
-                << g.getTypescriptTypename(paramID, scratch, scratch) << "();\n";
+                << g.getCachedTypescriptTypename(paramID, scratch) << "();\n";
             outputLoadSerializable(oss, space, ns, g, paramID, paramName, depth, scratch);
         }
         if (bArray) {
@@ -644,11 +644,11 @@ void outputLoadMap(std::ostream& oss, std::pmr::string& space, std::string_view
     std::pmr::string sizeName("sz", scratch);
     if (depth == 1) {
         OSS << sizeName << " = ar.readNumber(); // "
-            << g.getTypescriptTypename(vertID, scratch, scratch) << "\n";
+            << g.getCachedTypescriptTypename(vertID, scratch) << "\n";
     } else {
         sizeName.append(std::to_string(depth));
         OSS << "const " << sizeName << " = ar.readNumber(); // "
-            << g.getTypescriptTypename(vertID, scratch, scratch) << "\n";
+            << g.getCachedTypescriptTypename(vertID, scratch) << "\n";
     }
 
     // elememt
@@ -683,7 +683,7 @@ void outputLoadMap(std::ostream& oss, std::pmr::string& space, std::string_view
             outputLoadSerializable(oss, space2, ns, g, keyID, "", depth, scratch);
         } else {
             OSS << "const " << keyName << " = new "
-                << g.getTypescriptTypename(keyID, scratch, scratch) << "();\n";
+                << g.getCachedTypescriptTypename(keyID, scratch) << "();\n";
             outputLoadSerializable(oss, space, ns, g, keyID, keyName, depth, scratch);
         }
 
@@ -693,7 +693,7 @@ void outputLoadMap(std::ostream& oss, std::pmr::string& space, std::string_view
             outputLoadSerializable(oss, space2, ns, g, valueID, "", depth, scratch);
         } else {
             OSS << "const " << valueName << " = new "
-                << g.getTypescriptTypename(valueID, scratch, scratch) << "();\n";
+                << g.getCachedTypescriptTypename(valueID, scratch) << "();\n";
             outputLoadSerializable(oss, space, ns, g, valueID, valueName, depth, scratch);
         }
         const auto& keyTraits = get(g.traits, g, keyID);
@@ -710,7 +710,7 @@ std::pmr::string generateGraphSerialization_ts(
     std::string_view ns,
     const SyntaxGraph& g, SyntaxGraph::vertex_descriptor vertID,
     const Graph& s, std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios::out, scratch);
+    CodeStream oss(scratch);
     std::pmr::string space(scratch);
     Expects(s.isVector());
 
@@ -769,7 +769,7 @@ std::pmr::string generateGraphSerialization_ts(
                 outputSaveSerializable(oss, space, ns, g, sizeID, "g.getParent(v)", 0, false, scratch);
             }
             for (const auto& c : s.mComponents) {
-                const auto componentID = locate(c.mValuePath, g);
+                const auto componentID = locate(c, g);
                 std::pmr::string componentVar("g.get", scratch);
                 componentVar.append(convertTag(c.mName));
                 componentVar.append("(v)");
@@ -778,7 +778,7 @@ std::pmr::string generateGraphSerialization_ts(
             if (s.isPolymorphic()) {
                 OSS << "switch (g.id(v)) {\n";
                 for (const auto& c : s.mPolymorphic.mConcepts) {
-                    const auto objectID = locate(c.mValue, g);
+                    const auto objectID = locate(c, g);
                     const auto tagID = locate(c.mTag, g);
                     const auto& tagName = get(g.names, g, tagID);
                     std::pmr::string objectVar("g.get", scratch);
@@ -805,7 +805,7 @@ std::pmr::string generateGraphSerialization_ts(
             if (m.mFlags & GenerationFlags::NO_SERIALIZATION)
                 continue;
 
-            auto memberID = locate(m.mTypePath, g);
+            auto memberID = locate(m, g);
             if ((m.mFlags & GenerationFlags::NO_SERIALIZATION)
                 || (m.mFlags & GenerationFlags::IMPL_DETAIL)) {
                 continue;
@@ -841,7 +841,7 @@ std::pmr::string generateGraphSerialization_ts(
                 outputLoadSerializable(oss, space, ns, g, sizeID, "const u", 0, scratch);
             }
             for (const auto& c : s.mComponents) {
-                const auto componentID = locate(c.mValuePath, g);
+                const auto componentID = locate(c, g);
                 std::pmr::string componentVar(scratch);
                 if (g.isTypescriptValueType(componentID)) {
                     componentVar.append("const ");
@@ -849,14 +849,14 @@ std::pmr::string generateGraphSerialization_ts(
                 } else {
                     componentVar.append(getTagVariableName(c.mName, scratch));
                     OSS << "const " << componentVar << " = new "
-                        << g.getTypescriptTypename(componentID, scratch, scratch) << "();\n";
+                        << g.getCachedTypescriptTypename(componentID, scratch) << "();\n";
                 }
                 outputLoadSerializable(oss, space, ns, g, componentID, componentVar, 0, scratch);
             }
             if (s.isPolymorphic()) {
                 OSS << "switch (id) {\n";
                 for (const auto& c : s.mPolymorphic.mConcepts) {
-                    const auto objectID = locate(c.mValue, g);
+                    const auto objectID = locate(c, g);
                     const auto tagID = locate(c.mTag, g);
                     const auto& tagName = get(g.names, g, tagID);
                     std::pmr::string objectVar(scratch);
@@ -871,12 +871,12 @@ std::pmr::string generateGraphSerialization_ts(
                             outputLoadSerializable(oss, space, ns, g, objectID, "const " + objectVar, 0, scratch);
                         } else {
                             OSS << "const " << objectVar << " = new "
-                                << g.getTypescriptTypename(objectID, scratch, scratch) << "();\n";
+                                << g.getCachedTypescriptTypename(objectID, scratch) << "();\n";
                             outputLoadSerializable(oss, space, ns, g, objectID, objectVar, 0, scratch);
                         }
                         OSS << "g.addVertex<" << typeName << ">(" << typeName << ", " << objectVar;
                         for (const auto& c : s.mComponents) {
-                            const auto componentID = locate(c.mValuePath, g);
+                            const auto componentID = locate(c, g);
                             std::pmr::string componentVar(scratch);
                             componentVar.append(getTagVariableName(c.mName, scratch));
                             oss << ", " << componentVar;
@@ -898,7 +898,7 @@ std::pmr::string generateGraphSerialization_ts(
                     if (count++) {
                         oss << ", ";
                     }
-                    const auto componentID = locate(c.mValuePath, g);
+                    const auto componentID = locate(c, g);
                     std::pmr::string componentVar(scratch);
                     componentVar.append(getTagVariableName(c.mName, scratch));
                     oss << componentVar;
@@ -917,7 +917,7 @@ std::pmr::string generateGraphSerialization_ts(
             if (m.mFlags & GenerationFlags::NO_SERIALIZATION)
                 continue;
 
-            auto memberID = locate(m.mTypePath, g);
+            auto memberID = locate(m, g);
             if ((m.mFlags & GenerationFlags::NO_SERIALIZATION)
                 || (m.mFlags & GenerationFlags::IMPL_DETAIL)) {
                 continue;
@@ -931,7 +931,7 @@ std::pmr::string generateGraphSerialization_ts(
         }
     }
     oss << "}\n";
-    return oss.str();
+    return oss.release();
 }
 
 } // namespace
@@ -943,7 +943,7 @@ std::pmr::string generateSerialization_ts(
     bool nvp,
     std::pmr::memory_resource* mr,
     std::pmr::memory_resource* scratch) {
-    pmr_ostringstream oss(std::ios_base::out, mr);
+    CodeStream oss(mr);
     std::pmr::string space(scratch);
 
     const auto moduleID = locate(moduleName0, mg);
@@ -955,12 +955,7 @@ std::pmr::string generateSerialization_ts(
     std::string_view ns = "/cc/render";
 
     int numTrival = 0;
-    for (const auto& vertID : make_range(vertices(g))) {
-        const auto& moduleName = get(g.modulePaths, g, vertID);
-        if (moduleName != moduleName0) {
-            continue;
-        }
-
+    for (const auto& vertID : g.getModuleVertices(moduleName0)) {
         if (holds_tag<Define_>(vertID, g)) {
             continue;
         }
@@ -1002,7 +997,7 @@ std::pmr::string generateSerialization_ts(
                             if (m.mFlags & GenerationFlags::NO_SERIALIZATION)
                                 continue;
 
-                            auto memberID = locate(m.mTypePath, g);
+                            auto memberID = locate(m, g);
                             if ((m.mFlags & GenerationFlags::NO_SERIALIZATION)
                                 || (m.mFlags & GenerationFlags::IMPL_DETAIL)) {
                                 continue;
@@ -1026,7 +1021,7 @@ std::pmr::string generateSerialization_ts(
                             if (m.mFlags & GenerationFlags::NO_SERIALIZATION)
                                 continue;
 
-                            auto memberID = locate(m.mTypePath, g);
+                            auto memberID = locate(m, g);
                             if ((m.mFlags & GenerationFlags::NO_SERIALIZATION)
                                 || (m.mFlags & GenerationFlags::IMPL_DETAIL)) {
                                 continue;
@@ -1053,7 +1048,7 @@ std::pmr::string generateSerialization_ts(
             });
     }
 
-    return oss.str();
+    return oss.release();
 }
 
 namespace {
@@ -1133,7 +1128,7 @@ void outputFunctions(std::ostream& oss, std::pmr::string& space,
                 for (const auto& m : s.mMembers) {
                     if (m.mFlags & GenerationFlags::NO_EQUAL)
                         continue;
-                    auto memberID = locate(m.mTypePath, g);
+                    auto memberID = locate(m, g);
                     if ((m.mFlags & GenerationFlags::NO_EQUAL)
                         || (m.mFlags & GenerationFlags::IMPL_DETAIL)) {
                         continue;
@@ -1198,7 +1193,7 @@ void outputFunctions(std::ostream& oss, std::pmr::string& space,
                         oss << "equal" << memberName << "(" << lhs << ", " << rhs << ")";
                     } else {
                         oss << "/* skip: " << m.getMemberName() << ": "
-                            << g.getTypescriptTypename(vertID, scratch, scratch) << " */";
+                            << g.getCachedTypescriptTypename(vertID, scratch) << " */";
                     }
                 }
                 if (count) {
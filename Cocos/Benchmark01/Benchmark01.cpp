@@ -0,0 +1,344 @@
+#include <Cocos/AST/SyntaxGraphs.h>
+#include <Cocos/AST/BuilderTypes.h>
+#include <Cocos/AST/CppDefaultValues.h>
+#include <Cocos/AST/Snapshot.h>
+#include <Cocos/AST/TypescriptDefaultValues.h>
+#include <Cocos/FileUtils.h>
+#include <atomic>
+#include <chrono>
+#include <fstream>
+#include <iostream>
+#include <thread>
+// Scaling benchmark: builds synthetic schemas of growing size through the ModuleBuilder API,
+// and reports the time, peak memory and output size of each phase as csv,
+// along with the cost of saving and reloading the compiled schema as a snapshot.
+// usage: Cocos.Benchmark01 [outputFolder] [maxTypes]
+
+using namespace Cocos;
+using namespace Cocos::Meta;
+
+namespace {
+
+// Counts the bytes held by the memory resources built on top of it.
+// Installed as the default resource, so the worker pools of outputModules are counted too.
+class PeakMemoryResource final : public std::pmr::memory_resource {
+public:
+    explicit PeakMemoryResource(std::pmr::memory_resource* upstream) noexcept
+        : mUpstream(upstream) {}
+
+    void resetPeak() noexcept {
+        mPeak = mCurrent.load();
+    }
+    uint64_t peak() const noexcept {
+        return mPeak;
+    }
+
+private:
+    void* do_allocate(size_t bytes, size_t alignment) override {
+        auto* ptr = mUpstream->allocate(bytes, alignment);
+        const auto current = mCurrent += bytes;
+        auto peak = mPeak.load();
+        while (current > peak && !mPeak.compare_exchange_weak(peak, current)) {
+        }
+        return ptr;
+    }
+    void do_deallocate(void* p, size_t bytes, size_t alignment) override {
+        mUpstream->deallocate(p, bytes, alignment);
+        mCurrent -= bytes;
+    }
+    bool do_is_equal(const std::pmr::memory_resource& rhs) const noexcept override {
+        return this == &rhs;
+    }
+
+    std::pmr::memory_resource* mUpstream = nullptr;
+    std::atomic<uint64_t> mCurrent = 0;
+    std::atomic<uint64_t> mPeak = 0;
+};
+
+struct SchemaSize {
+    uint32_t mNumModules = 0;
+    uint32_t mNumStructs = 0; // per module
+    uint32_t mNumMembers = 0; // per struct
+    uint32_t mNumGraphs = 0; // per module
+};
+
+struct SchemaResult {
+    double mBuildMS = 0;
+    double mCompileMS = 0;
+    double mOutputMS = 0;
+    double mWriteSnapshotMS = 0;
+    double mReadSnapshotMS = 0;
+    uint64_t mSnapshotBytes = 0;
+    uint64_t mPeakBytes = 0;
+    uint64_t mNumFiles = 0;
+    uint64_t mOutputBytes = 0;
+};
+
+using Clock = std::chrono::steady_clock;
+
+double getMilliseconds(Clock::time_point start) noexcept {
+    return std::chrono::duration<double, std::milli>(Clock::now() - start).count();
+}
+
+std::pmr::string getModuleName(uint32_t moduleID, std::pmr::memory_resource* scratch) {
+    std::pmr::string name("Bench", scratch);
+    name.append(std::to_string(moduleID));
+    return name;
+}
+
+std::pmr::string getStructName(uint32_t moduleID, uint32_t structID,
+    std::pmr::memory_resource* scratch) {
+    auto name = getModuleName(moduleID, scratch);
+    name.append("Struct");
+    name.append(std::to_string(structID));
+    return name;
+}
+
+// Every module requires the first one, so that dependent names are resolved across modules.
+// Members cycle through builtin types, pmr strings, the previous struct of the same module
+// and structs of the first module.
+void buildSchema(ModuleBuilder& builder, const SchemaSize& size,
+    std::pmr::memory_resource* scratch) {
+    addCppDefaultValues(builder);
+    projectTypescriptDefaultValues(builder);
+
+    const auto features = Fwd | Types | Names | Graphs | Typescripts;
+
+    for (uint32_t moduleID = 0; moduleID != size.mNumModules; ++moduleID) {
+        const auto moduleName = getModuleName(moduleID, scratch);
+        std::pmr::string filename("bench-", scratch);
+        filename.append(std::to_string(moduleID));
+
+        auto m = builder.openModule(moduleName,
+            ModuleInfo{
+                .mFeatures = features,
+                .mFolder = "bench",
+                .mFilePrefix = std::string(moduleName),
+                .mTypescriptFolder = "bench",
+                .mTypescriptFilePrefix = std::string(filename),
+                .mRequires = moduleID ? std::vector<std::string>{ "Bench0" } : std::vector<std::string>{},
+            });
+
+        auto cc = builder.openNamespace("cc");
+
+        for (uint32_t structID = 0; structID != size.mNumStructs; ++structID) {
+            const auto structName = getStructName(moduleID, structID, scratch);
+            auto structHandle = builder.addStruct(structName,
+                Traits{ .mPmr = size.mNumMembers > 1 });
+            auto vertID = structHandle.mVertexDescriptor;
+
+            for (uint32_t memberID = 0; memberID != size.mNumMembers; ++memberID) {
+                std::pmr::string memberName("mMember", scratch);
+                memberName.append(std::to_string(memberID));
+
+                switch (memberID % 4) {
+                case 0:
+                    builder.addMember(vertID, true, "uint32_t", memberName, "0");
+                    break;
+                case 1:
+                    builder.addMember(vertID, true, "std::pmr::string", memberName, "_");
+                    break;
+                case 2:
+                    // one reference per struct, the member checks of SyntaxGraph are not memoized
+                    // and a struct holding its predecessor twice doubles their cost per level
+                    if (structID && memberID == 2) {
+                        const auto typeName = getStructName(moduleID, structID - 1, scratch);
+                        builder.addMember(vertID, true, typeName, memberName, "_");
+                    } else {
+                        builder.addMember(vertID, true, "float", memberName, "0");
+                    }
+                    break;
+                default:
+                    if (moduleID) {
+                        const auto typeName = getStructName(0, memberID % size.mNumStructs, scratch);
+                        builder.addMember(vertID, true, typeName, memberName, "_");
+                    } else {
+                        builder.addMember(vertID, true, "double", memberName, "0");
+                    }
+                    break;
+                }
+            }
+        }
+
+        for (uint32_t graphID = 0; graphID != size.mNumGraphs; ++graphID) {
+            auto graphName = moduleName;
+            graphName.append("Graph");
+            graphName.append(std::to_string(graphID));
+
+            // polymorphic vertices, one tag per struct kind
+            const uint32_t numKinds = std::min(size.mNumStructs, 4u);
+            std::pmr::vector<std::pmr::string> tags(scratch);
+            for (uint32_t kind = 0; kind != numKinds; ++kind) {
+                auto tag = graphName;
+                tag.append("Kind");
+                tag.append(std::to_string(kind));
+                tag.append("_");
+                builder.addTag(tag);
+                tags.emplace_back(std::move(tag));
+            }
+
+            auto graphHandle = builder.addGraph(graphName, "_", "_", Traits{ .mPmr = true });
+            auto vertID = graphHandle.mVertexDescriptor;
+            auto& g = get_by_tag<Graph_>(vertID, builder.mSyntaxGraph);
+            g.mNamed = true;
+            g.mNamedConcept.mComponentName = "Name_";
+            g.mReferenceGraph = true;
+            g.mAddressable = true;
+            g.mAddressableConcept.mMemberName = "mPathIndex";
+
+            builder.addGraphComponent(vertID, "Name_", "std::pmr::string", "mNames");
+            builder.addGraphComponent(vertID, "Data_",
+                getStructName(moduleID, 0, scratch), "mData");
+
+            for (uint32_t kind = 0; kind != numKinds; ++kind) {
+                std::pmr::string memberName("mKind", scratch);
+                memberName.append(std::to_string(kind));
+                builder.addGraphPolymorphic(vertID, tags[kind],
+                    getStructName(moduleID, kind, scratch), memberName);
+            }
+        }
+    }
+}
+
+uint64_t countFiles(const std::filesystem::path& folder, uint64_t& numBytes) {
+    uint64_t numFiles = 0;
+    numBytes = 0;
+    for (const auto& entry : std::filesystem::recursive_directory_iterator(folder)) {
+        if (entry.is_regular_file()) {
+            ++numFiles;
+            numBytes += entry.file_size();
+        }
+    }
+    return numFiles;
+}
+
+SchemaResult runSchema(const SchemaSize& size, const std::filesystem::path& outputFolder,
+    const std::filesystem::path& snapshotFile, PeakMemoryResource& memory) {
+    SchemaResult result;
+
+    // start from an empty folder, so that every file is written
+    std::filesystem::remove_all(outputFolder);
+    std::filesystem::create_directories(outputFolder / "bench");
+
+    memory.resetPeak();
+    {
+        std::pmr::unsynchronized_pool_resource pool(&memory);
+        ModuleBuilder builder("cc", outputFolder, outputFolder, &pool, &pool);
+        builder.init();
+
+        auto start = Clock::now();
+        buildSchema(builder, size, &pool);
+        result.mBuildMS = getMilliseconds(start);
+
+        start = Clock::now();
+        builder.compile();
+        result.mCompileMS = getMilliseconds(start);
+
+        start = Clock::now();
+        writeSnapshot(snapshotFile, builder);
+        result.mWriteSnapshotMS = getMilliseconds(start);
+
+        std::pmr::vector<std::pmr::string> names(&pool);
+        names.reserve(size.mNumModules);
+        for (uint32_t moduleID = 0; moduleID != size.mNumModules; ++moduleID) {
+            names.emplace_back(getModuleName(moduleID, &pool));
+        }
+        std::pmr::vector<std::string_view> modules(names.begin(), names.end(), &pool);
+
+        start = Clock::now();
+        std::pmr::set<std::pmr::string> files(&pool);
+        builder.outputModules(modules, files, std::thread::hardware_concurrency());
+        result.mOutputMS = getMilliseconds(start);
+    }
+    result.mPeakBytes = memory.peak();
+    result.mNumFiles = countFiles(outputFolder, result.mOutputBytes);
+
+    // loading replaces building and compiling the schema
+    {
+        std::pmr::unsynchronized_pool_resource pool(&memory);
+        ModuleBuilder builder("cc", outputFolder, outputFolder, &pool, &pool);
+        builder.init();
+
+        const auto start = Clock::now();
+        bool loaded = true;
+        try {
+            readSnapshot(snapshotFile, builder);
+        } catch (const std::runtime_error& e) {
+            std::cerr << e.what() << std::endl;
+            loaded = false;
+        }
+        if (!loaded) {
+            // a rejected snapshot falls back to building and compiling the schema
+            ModuleBuilder fallback("cc", outputFolder, outputFolder, &pool, &pool);
+            fallback.init();
+            buildSchema(fallback, size, &pool);
+            fallback.compile();
+        }
+        result.mReadSnapshotMS = getMilliseconds(start);
+    }
+    result.mSnapshotBytes = std::filesystem::file_size(snapshotFile);
+
+    return result;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    std::filesystem::path outputFolder = "benchmark";
+    uint32_t maxTypes = 100000;
+    if (argc > 1) {
+        outputFolder = argv[1];
+    }
+    if (argc > 2) {
+        maxTypes = static_cast<uint32_t>(std::stoul(argv[2]));
+    }
+
+    PeakMemoryResource memory(std::pmr::new_delete_resource());
+    auto* prevResource = std::pmr::set_default_resource(&memory);
+
+    std::ostringstream oss;
+    oss << "types,modules,structs,members,graphs,build_ms,compile_ms,output_ms,peak_bytes,files,output_bytes,"
+           "snapshot_write_ms,snapshot_read_ms,snapshot_bytes\n";
+
+    // the module count grows with the schema, the module size stays constant
+    constexpr uint32_t numStructs = 50;
+    constexpr uint32_t numMembers = 8;
+    constexpr uint32_t numGraphs = 1;
+    for (uint32_t numTypes = 100; numTypes <= maxTypes; numTypes *= 10) {
+        const SchemaSize size{
+            .mNumModules = numTypes / numStructs,
+            .mNumStructs = numStructs,
+            .mNumMembers = numMembers,
+            .mNumGraphs = numGraphs,
+        };
+        const auto result = runSchema(size,
+            outputFolder / "schema", outputFolder / "schema.snapshot", memory);
+
+        oss << numTypes << ','
+            << size.mNumModules << ','
+            << size.mNumStructs << ','
+            << size.mNumMembers << ','
+            << size.mNumModules * size.mNumGraphs << ','
+            << result.mBuildMS << ','
+            << result.mCompileMS << ','
+            << result.mOutputMS << ','
+            << result.mPeakBytes << ','
+            << result.mNumFiles << ','
+            << result.mOutputBytes << ','
+            << result.mWriteSnapshotMS << ','
+            << result.mReadSnapshotMS << ','
+            << result.mSnapshotBytes << '\n';
+
+        std::cout << "types: " << numTypes
+                  << ", compile: " << result.mCompileMS << "ms"
+                  << ", output: " << result.mOutputMS << "ms"
+                  << ", snapshot: " << result.mReadSnapshotMS << "ms"
+                  << ", peak: " << result.mPeakBytes / (1024 * 1024) << "MB"
+                  << std::endl;
+    }
+
+    std::pmr::set_default_resource(prevResource);
+
+    updateFile(outputFolder / "benchmark.csv", oss.str());
+    std::cout << oss.str();
+}
@@ -25,24 +25,36 @@ THE SOFTWARE.
 */
 
 #include <Cocos/AST/CppDefaultValues.h>
+#include <Cocos/AST/Fingerprint.h>
+#include <Cocos/AST/Profiler.h>
 #include <Cocos/AST/TypescriptDefaultValues.h>
 #include <Cocos/FileUtils.h>
 #include <Cocos/Indent.h>
 #include "CocosModules.h"
 #include <iostream>
+#include <thread>
 
 using namespace Cocos;
 using namespace Cocos::Meta;
 
 int main() {
     std::pmr::unsynchronized_pool_resource pool;
+#if CC_GENERATOR_PROFILE
+    ProfileMemoryResource profiled(&pool);
+    std::pmr::memory_resource* scratch = &profiled;
+#else
     std::pmr::memory_resource* scratch = &pool;
+#endif
 
     // output folder
     std::filesystem::path typescriptFolder = "../../../cocos-engine";
     std::filesystem::path cppFolder = "../../../cocos-engine/native";
 
     ModuleBuilder builder("cc", cppFolder, typescriptFolder, scratch, scratch);
+    // kept next to the generator, the engine tree only receives generated sources
+    if (auto generator = getGeneratorPath(); !generator.empty()) {
+        builder.mFingerprintFile = generator.parent_path() / "CocosBuilder.fingerprints";
+    }
     builder.init();
 
     // type registration
@@ -136,34 +148,46 @@ int main() {
         files.emplace("cocos/renderer/pipeline/custom/NativeBuiltinUtils.cpp");
         files.emplace("cocos/renderer/pipeline/custom/NativeSetter.cpp");
 
+        std::pmr::vector<std::string_view> modules(scratch);
+
         // common types, shared by different modules
-        builder.outputModule("RenderCommon", files);
+        modules.emplace_back("RenderCommon");
 
         // descriptor layout graph
-        builder.outputModule("LayoutGraph", files);
+        modules.emplace_back("LayoutGraph");
 
         // render graph
-        builder.outputModule("RenderGraph", files);
-        builder.outputModule("Customization", files);
-        builder.outputModule("ArchiveInterface", files);
-        builder.outputModule("RenderInterface", files);
-        builder.outputModule("PrivateInterface", files);
+        modules.emplace_back("RenderGraph");
+        modules.emplace_back("Customization");
+        modules.emplace_back("ArchiveInterface");
+        modules.emplace_back("RenderInterface");
+        modules.emplace_back("PrivateInterface");
 
-        builder.outputModule("FGDispatcher", files);
+        modules.emplace_back("FGDispatcher");
 
         // private
-        builder.outputModule("PrivateTypes", files);
+        modules.emplace_back("PrivateTypes");
 
         // native
         if (false) {
-            builder.outputModule("RenderCompiler", files);
+            modules.emplace_back("RenderCompiler");
         }
-        builder.outputModule("NativePipeline", files);
+        modules.emplace_back("NativePipeline");
 
         // render example
         if (false) {
-            builder.outputModule("ExecutorExample", files);
-            builder.outputModule("RenderExample", files);
+            modules.emplace_back("ExecutorExample");
+            modules.emplace_back("RenderExample");
+        }
+
+        const auto skipped = builder.outputModules(
+            modules, files, std::thread::hardware_concurrency());
+        for (const auto& name : modules) {
+            if (std::find(skipped.begin(), skipped.end(), name) != skipped.end()) {
+                std::cout << "skipped '" << name << "'" << std::endl;
+            } else {
+                std::cout << "regenerated '" << name << "'" << std::endl;
+            }
         }
     }
 
@@ -211,5 +235,22 @@ int main() {
         }
     }
 
+    {
+        const auto& stats = getFileUpdateStats();
+        std::cout << "files checked: " << stats.mFilesChecked
+                  << ", bytes compared: " << stats.mBytesCompared
+                  << ", files written: " << stats.mFilesWritten << std::endl;
+    }
+    {
+        const auto stats = builder.mSyntaxGraph.mNameCache.getStats();
+        std::cout << "name cache hits: " << stats.mHits
+                  << ", misses: " << stats.mMisses << std::endl;
+    }
+
+#if CC_GENERATOR_PROFILE
+    writeProfileTrace("generator-trace.json");
+    printProfileSummary(std::cout);
+#endif
+
     return 0;
 }
@@ -31,6 +31,7 @@ THE SOFTWARE.
 namespace Cocos::Meta {
 
 void buildCocosCommon(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     NAMESPACE(cc) {
         CONTAINER(IntrusivePtr, .mFlags = JSB);
         PROJECT_TS(IntrusivePtr, _);
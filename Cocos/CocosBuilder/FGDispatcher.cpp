@@ -33,6 +33,7 @@ namespace Cocos::Meta {
 // clang-format off
 
 void buildFGDispatcher(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(FGDispatcher,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "FGDispatcher",
@@ -127,7 +128,7 @@ void buildFGDispatcher(ModuleBuilder& builder, Features features) {
         PMR_GRAPH(ResourceAccessGraph, _, _, .mFlags = NO_MOVE_NO_COPY) {
             PUBLIC(
                 (ccstd::pmr::vector<ccstd::pmr::string>, mResourceNames, _)
-                ((PmrUnorderedStringMap<ccstd::pmr::string, uint32_t>), mResourceIndex, _)
+                ((PmrFrozenStringMap<ccstd::pmr::string, uint32_t>), mResourceIndex, _)
                 (ResourceAccessGraph::vertex_descriptor, mPresentPassID, 0xFFFFFFFF, "present pass")
                 ((PmrFlatMap<ResourceAccessGraph::vertex_descriptor, LeafStatus>), mLeafPasses, _)
                 ((PmrFlatSet<ResourceAccessGraph::vertex_descriptor>), mCulledPasses, _)
@@ -142,6 +143,8 @@ void buildFGDispatcher(ModuleBuilder& builder, Features features) {
                 (AccessNode_, ResourceAccessNode, mAccess)
             );
             COMPONENT_BIMAP(PmrUnorderedMap, mPassIndex, PassID_);
+            ORDERED_DAG_GRAPH();
+            LEVEL_GRAPH();
             MEMBER_FUNCTIONS(R"(
 ~ResourceAccessGraph() {
     for (auto& node : access) {
@@ -160,6 +163,8 @@ void buildFGDispatcher(ModuleBuilder& builder, Features features) {
         }
 
         PMR_GRAPH(RelationGraph, _, _, .mFlags = NO_MOVE_NO_COPY) {
+            SMALL_EDGE_LIST(4);
+            DESCRIPTOR_TYPE(uint16_t);
             COMPONENT_GRAPH(
                 (DescID_, ResourceAccessGraph::vertex_descriptor, mDescID)
             );
@@ -33,6 +33,7 @@ namespace Cocos::Meta {
 // clang-format off
     
 void buildLayoutGraph(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(LayoutGraph,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "LayoutGraph",
@@ -98,6 +99,7 @@ import { saveUniformBlock, loadUniformBlock, saveDescriptorSetLayoutInfo, loadDe
             NAMED_GRAPH(Name_);
             ALIAS_REFERENCE_GRAPH();
             ADDRESSABLE_GRAPH(mPathIndex);
+            PATH_TRIE();
 
             COMPONENT_GRAPH(
                 (Name_, ccstd::pmr::string, mNames)
@@ -252,6 +254,7 @@ import { saveUniformBlock, loadUniformBlock, saveDescriptorSetLayoutInfo, loadDe
             NAMED_GRAPH(Name_);
             ALIAS_REFERENCE_GRAPH();
             ADDRESSABLE_GRAPH(mPathIndex);
+            PATH_TRIE();
 
             COMPONENT_GRAPH(
                 (Name_, ccstd::pmr::string, mNames)
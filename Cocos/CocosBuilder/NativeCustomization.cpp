@@ -33,6 +33,7 @@ namespace Cocos::Meta {
 // clang-format off
 
 void buildCustomization(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(Customization,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "Custom",
@@ -33,6 +33,7 @@ namespace Cocos::Meta {
 // clang-format off
 
 void buildNativePipeline(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(NativePipeline,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "NativePipeline",
@@ -33,6 +33,7 @@ namespace Cocos::Meta {
 // clang-format off
 
 void buildPrivateTypes(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(PrivateTypes,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "Native",
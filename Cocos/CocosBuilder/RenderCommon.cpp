@@ -41,6 +41,7 @@ namespace Cocos::Meta {
 // clang-format off
 
 void buildRenderCommon(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(RenderCommon,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "RenderCommon",
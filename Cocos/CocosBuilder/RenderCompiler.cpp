@@ -31,6 +31,7 @@ THE SOFTWARE.
 namespace Cocos::Meta {
 
 void buildRenderCompiler(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(RenderCompiler,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "RenderCompiler",
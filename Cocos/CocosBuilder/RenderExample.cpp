@@ -31,6 +31,7 @@ THE SOFTWARE.
 namespace Cocos::Meta {
 
 void buildRenderExample(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(RenderExample,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "RenderExample",
@@ -31,6 +31,7 @@ THE SOFTWARE.
 namespace Cocos::Meta {
 
 void buildExecutorExample(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(ExecutorExample,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "RenderExecutor",
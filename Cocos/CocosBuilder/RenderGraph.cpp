@@ -33,6 +33,7 @@ THE SOFTWARE.
 namespace Cocos::Meta {
 
 void buildRenderGraph(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(RenderGraph,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "RenderGraph",
@@ -200,6 +201,7 @@ bool checkResource(const ResourceDesc &desc) const;
 
         PMR_GRAPH(SubpassGraph, _, _, .mFlags = POOL_OBJECT) {
             NAMED_GRAPH(Name_);
+            SMALL_EDGE_LIST(4);
             COMPONENT_GRAPH(
                 (Name_, ccstd::pmr::string, mNames)
                 (Subpass_, Subpass, mSubpasses)
@@ -464,6 +466,10 @@ void invalidatePersistentRenderPassAndFramebuffer(gfx::Texture* pTexture);
         PMR_GRAPH(RenderGraph, _, _, .mFlags = NO_COPY) {
             NAMED_GRAPH(Name_);
             REFERENCE_GRAPH();
+            SMALL_EDGE_LIST(4);
+            CSR_FREEZE();
+            FRAGMENT_GRAPH();
+            OBJECT_RANGES();
 
             COMPONENT_GRAPH(
                 (Name_, ccstd::pmr::string, mNames)
@@ -489,7 +495,7 @@ void invalidatePersistentRenderPassAndFramebuffer(gfx::Texture* pTexture);
                 (Viewport_, gfx::Viewport, mViewports)
             );
             PUBLIC(
-                ((PmrUnorderedStringMap<ccstd::pmr::string, uint32_t>), mIndex, _)
+                ((PmrFrozenStringMap<ccstd::pmr::string, uint32_t>), mIndex, _)
                 (ccstd::pmr::vector<RenderGraph::vertex_descriptor>, mSortedVertices, _)
             );
             MEMBER_FUNCTIONS(R"(
@@ -7,6 +7,7 @@
 namespace Cocos::Meta {
 
 void buildArchiveInterface(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(ArchiveInterface,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "Archive",
@@ -50,6 +51,7 @@ virtual std::string_view readString() = 0;
 }
 
 void buildRenderInterface(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(RenderInterface,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "RenderInterface",
@@ -464,6 +466,7 @@ static Pipeline *createPipeline();
 }
 
 void buildPrivateInterface(ModuleBuilder& builder, Features features) {
+    PROFILE_SCOPE(__func__);
     MODULE(PrivateInterface,
         .mFolder = "cocos/renderer/pipeline/custom",
         .mFilePrefix = "Private",
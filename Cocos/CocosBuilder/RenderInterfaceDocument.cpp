@@ -7,6 +7,7 @@
 namespace Cocos::Meta {
     
 void buildRenderInterfaceDocument(ModuleBuilder& builder) {
+    PROFILE_SCOPE(__func__);
     NAMESPACE_BEG(cc);
     NAMESPACE_BEG(render);
 
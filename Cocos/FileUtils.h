@@ -26,11 +26,16 @@ THE SOFTWARE.
 
 #pragma once
 #include <gsl/gsl_assert>
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
 #include <filesystem>
 #include <fstream>
 #include <sstream>
 #include <memory>
 #include <string>
+#include <utility>
 #include <boost/iostreams/device/array.hpp>
 #include <boost/iostreams/device/back_inserter.hpp>
 #include <boost/iostreams/stream.hpp>
@@ -66,17 +71,6 @@ inline void readFileBuffer(const std::filesystem::path& file, std::pmr::string&
     ifs.read(buffer.data(), sz);
 }
 
-inline bool updateFile(const std::filesystem::path& file, std::string_view content) {
-    std::string orig = readFile(file, false);
-    if (orig != content) {
-        std::ofstream ofs(file);
-        ofs.exceptions(std::ostream::failbit);
-        ofs.write(content.data(), content.size());
-        return true;
-    }
-    return false;
-}
-
 inline void readBinary(const std::filesystem::path& file, std::pmr::string& buffer) {
     std::ifstream ifs(file, std::ios::binary);
     ifs.exceptions(std::ios_base::failbit);
@@ -103,62 +97,104 @@ inline void readBinary(const std::filesystem::path& file, std::pmr::string& buff
     ifs.read(buffer.data(), sz);
 }
 
-inline bool updateBinary(const std::filesystem::path& file, std::string_view content) {
-    std::string orig = readBinary(file, false);
-    if (orig != content) {
-        std::ofstream ofs(file, std::ios::binary);
-        ofs.exceptions(std::ostream::failbit);
-        ofs.write(content.data(), content.size());
-        return true;
+struct FileUpdateStats {
+    std::atomic<uint64_t> mFilesChecked = 0;
+    std::atomic<uint64_t> mBytesCompared = 0;
+    std::atomic<uint64_t> mFilesWritten = 0;
+};
+
+inline FileUpdateStats& getFileUpdateStats() noexcept {
+    static FileUpdateStats sStats;
+    return sStats;
+}
+
+// Sizes a file on disk may have and still read back as content.
+// On Windows, text mode reads "\r\n" back as '\n', so the file may hold
+// either line ending, e.g. a checkout with LF, and any mix of both.
+inline std::pair<uint64_t, uint64_t> getNativeFileSizeRange(std::string_view content, bool binary) noexcept {
+    const uint64_t sz = content.size();
+#ifdef _WIN32
+    if (!binary) {
+        return { sz, sz + std::count(content.begin(), content.end(), '\n') };
     }
-    return false;
+#endif
+    return { sz, sz };
 }
 
-inline bool updateLargeBinary(const std::filesystem::path& file, std::string_view content) {
-    bool needUpdate = false;
-    {
-        std::ifstream ifs(file, std::ios::binary);
-        const auto sz = getFileSize(ifs);
-
-        if (sz != content.size()) {
-            needUpdate = true;
-        } else {
-            constexpr size_t BufferSize = 1024 * 1024;
-
-            std::string target;
-            target.reserve(BufferSize);
-
-            for (size_t pos = 0; pos != sz;) {
-                size_t bytesRead = BufferSize;
-                if (pos + bytesRead > sz) {
-                    bytesRead = sz - pos;
-                }
-
-                target.resize(bytesRead);
-                ifs.read(target.data(), target.size());
-                std::string_view source(content.data() + pos, bytesRead);
-
-                Ensures(source.size() == target.size());
-                Ensures(source.size() == bytesRead);
-
-                if (memcmp(source.data(), target.data(), bytesRead)) {
-                    needUpdate = true;
-                    break;
-                }
-                
-                pos += bytesRead;
-            }
+// Compares the file against content chunk by chunk, without reading the whole file.
+// A missing file compares equal to empty content.
+inline bool isFileContentEqual(const std::filesystem::path& file, std::string_view content, bool binary) {
+    auto& stats = getFileUpdateStats();
+    ++stats.mFilesChecked;
+
+    std::error_code ec;
+    const auto sz = std::filesystem::file_size(file, ec);
+    if (ec) {
+        return content.empty();
+    }
+    // the size only rules out equality, the content is compared below
+    const auto [minSize, maxSize] = getNativeFileSizeRange(content, binary);
+    if (sz < minSize || sz > maxSize) {
+        return false;
+    }
+
+    std::ifstream ifs(file, binary ? std::ios::binary : std::ios::in);
+    if (!ifs) {
+        return content.empty();
+    }
+
+    constexpr size_t BufferSize = 64 * 1024;
+    std::array<char, BufferSize> buffer;
+
+    for (size_t pos = 0; pos != content.size();) {
+        const auto bytesExpected = std::min(BufferSize, content.size() - pos);
+        ifs.read(buffer.data(), bytesExpected);
+        const auto bytesRead = static_cast<size_t>(ifs.gcount());
+        stats.mBytesCompared += bytesRead;
+        if (bytesRead != bytesExpected) {
+            return false;
         }
+        if (memcmp(content.data() + pos, buffer.data(), bytesRead)) {
+            return false;
+        }
+        pos += bytesRead;
     }
+    return ifs.peek() == std::ifstream::traits_type::eof();
+}
 
-    if (needUpdate) {
-        std::ofstream ofs(file, std::ios::binary);
+// Writes content to a temporary file next to the target, then renames it over the target.
+// Readers never observe a partially written file.
+inline void writeFileAtomic(const std::filesystem::path& file, std::string_view content, bool binary) {
+    auto tmp = file;
+    tmp += ".tmp";
+    {
+        std::ofstream ofs(tmp, binary ? std::ios::binary : std::ios::out);
         ofs.exceptions(std::ostream::failbit);
         ofs.write(content.data(), content.size());
-        return true;
     }
+    std::filesystem::rename(tmp, file);
+    ++getFileUpdateStats().mFilesWritten;
+}
+
+// Unchanged files are not touched, so their modification time is preserved.
+inline bool updateFile(const std::filesystem::path& file, std::string_view content) {
+    if (isFileContentEqual(file, content, false)) {
+        return false;
+    }
+    writeFileAtomic(file, content, false);
+    return true;
+}
 
-    return false;
+inline bool updateBinary(const std::filesystem::path& file, std::string_view content) {
+    if (isFileContentEqual(file, content, true)) {
+        return false;
+    }
+    writeFileAtomic(file, content, true);
+    return true;
+}
+
+inline bool updateLargeBinary(const std::filesystem::path& file, std::string_view content) {
+    return updateBinary(file, content);
 }
 
 inline bool copyFile(const std::filesystem::path& src, const std::filesystem::path& dst) {
@@ -5,6 +5,7 @@
 #include <boost/iterator/iterator_adaptor.hpp>
 #include <boost/graph/adjacency_iterator.hpp>
 #include <boost/graph/properties.hpp>
+#include <boost/graph/two_bit_color_map.hpp>
 #include <Cocos/Concept.h>
 #include <Cocos/GraphTypes.h>
 
@@ -825,6 +826,62 @@ struct ColorMap : public boost::put_get_helper<boost::default_color_type&, Color
     std::pmr::vector<boost::default_color_type>* mContainer = nullptr;
 };
 
+// colors are unpacked on read, so the map has no lvalue
+template<class Key>
+struct PackedColorMap {
+    using value_type = boost::two_bit_color_type;
+    using reference = boost::two_bit_color_type;
+    using key_type = Key;
+    using category = boost::read_write_property_map_tag;
+
+    PackedColorMap(PackedColors& colors) noexcept
+        : mColors{ &colors }
+    {}
+
+    PackedColors* mColors = nullptr;
+};
+
+template<class Key>
+[[nodiscard]] inline boost::two_bit_color_type get(const PackedColorMap<Key>& pm, const Key& v) noexcept {
+    const auto shift = (v % 32) * 2;
+    return static_cast<boost::two_bit_color_type>((pm.mColors->mWords[v / 32] >> shift) & 3);
+}
+
+template<class Key>
+inline void put(const PackedColorMap<Key>& pm, const Key& v, boost::two_bit_color_type color) noexcept {
+    const auto shift = (v % 32) * 2;
+    auto& word = pm.mColors->mWords[v / 32];
+    word = (word & ~(uint64_t(3) << shift)) | (static_cast<uint64_t>(color) << shift);
+}
+
+template<class Key>
+struct VisitedBitsetMap {
+    using value_type = bool;
+    using reference = bool;
+    using key_type = Key;
+    using category = boost::read_write_property_map_tag;
+
+    VisitedBitsetMap(VisitedBitset& visited) noexcept
+        : mVisited{ &visited }
+    {}
+
+    VisitedBitset* mVisited = nullptr;
+};
+
+template<class Key>
+[[nodiscard]] inline bool get(const VisitedBitsetMap<Key>& pm, const Key& v) noexcept {
+    return pm.mVisited->test(v);
+}
+
+template<class Key>
+inline void put(const VisitedBitsetMap<Key>& pm, const Key& v, bool visited) noexcept {
+    if (visited) {
+        pm.mVisited->set(v);
+    } else {
+        pm.mVisited->reset(v);
+    }
+}
+
 }
 
 namespace std {
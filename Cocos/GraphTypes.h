@@ -574,4 +574,371 @@ struct PmrListEdge {
     EdgeProperty mProperty;
 };
 
+// Edges allocated in blocks of 64 slots, an erased edge leaves a free slot for the next one.
+// Blocks never move, so iterators and edge properties stay valid until the edge is erased.
+// Iteration walks the blocks in slot order and skips the free slots with the alive masks.
+template<class T, class Allocator = std::allocator<T>>
+class EdgePool {
+    static constexpr uint32_t BlockSize = 64;
+
+    struct Block {
+        alignas(T) std::byte mStorage[sizeof(T) * BlockSize];
+    };
+
+    using value_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<T>;
+    using value_traits = std::allocator_traits<value_allocator>;
+    using block_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Block>;
+    using block_traits = std::allocator_traits<block_allocator>;
+
+    template<class Value, class Pool>
+    class Iterator : public boost::iterator_facade<
+        Iterator<Value, Pool>, Value, std::bidirectional_iterator_tag
+    > {
+    public:
+        Iterator() = default;
+        Iterator(Pool* pool, uint32_t slot) noexcept
+            : mPool(pool), mSlot(slot)
+        {}
+        template<class V, class P>
+        Iterator(const Iterator<V, P>& rhs) noexcept // NOLINT
+            : mPool(rhs.mPool), mSlot(rhs.mSlot)
+        {}
+    private:
+        friend class boost::iterator_core_access;
+        friend class EdgePool;
+        template<class V, class P>
+        friend class Iterator;
+
+        Value& dereference() const noexcept {
+            return *mPool->data(mSlot);
+        }
+        template<class V, class P>
+        bool equal(const Iterator<V, P>& rhs) const noexcept {
+            return mSlot == rhs.mSlot;
+        }
+        void increment() noexcept {
+            mSlot = mPool->nextAlive(mSlot + 1);
+        }
+        void decrement() noexcept {
+            mSlot = mPool->prevAlive(mSlot - 1);
+        }
+
+        Pool* mPool = nullptr;
+        uint32_t mSlot = 0;
+    };
+public:
+    using value_type = T;
+    using reference = T&;
+    using const_reference = const T&;
+    using size_type = uint32_t;
+    using difference_type = std::ptrdiff_t;
+    using allocator_type = Allocator;
+    using iterator = Iterator<T, EdgePool>;
+    using const_iterator = Iterator<const T, const EdgePool>;
+
+    EdgePool() = default;
+    explicit EdgePool(const allocator_type& alloc) noexcept
+        : mBlocks(alloc), mAlive(alloc), mFree(alloc), mAllocator(alloc)
+    {}
+    EdgePool(EdgePool&& rhs) noexcept
+        : mBlocks(std::move(rhs.mBlocks))
+        , mAlive(std::move(rhs.mAlive))
+        , mFree(std::move(rhs.mFree))
+        , mSize(std::exchange(rhs.mSize, 0))
+        , mAllocator(rhs.mAllocator)
+    {}
+    EdgePool(EdgePool&& rhs, const allocator_type& alloc)
+        : EdgePool(alloc)
+    {
+        if (mAllocator == rhs.mAllocator) {
+            swap(rhs);
+        } else {
+            assign(std::move(rhs));
+        }
+    }
+    EdgePool(const EdgePool& rhs)
+        : EdgePool(rhs, value_traits::select_on_container_copy_construction(rhs.mAllocator))
+    {}
+    EdgePool(const EdgePool& rhs, const allocator_type& alloc)
+        : EdgePool(alloc)
+    {
+        assign(rhs);
+    }
+    EdgePool& operator=(EdgePool&& rhs) {
+        if (this != &rhs) {
+            if (mAllocator == rhs.mAllocator) {
+                EdgePool(std::move(rhs)).swap(*this);
+            } else {
+                assign(std::move(rhs));
+            }
+        }
+        return *this;
+    }
+    EdgePool& operator=(const EdgePool& rhs) {
+        if (this != &rhs) {
+            assign(rhs);
+        }
+        return *this;
+    }
+    ~EdgePool() noexcept {
+        for (uint32_t slot = nextAlive(0); slot != capacity(); slot = nextAlive(slot + 1)) {
+            value_traits::destroy(mAllocator, data(slot));
+        }
+        block_allocator alloc(mAllocator);
+        for (auto* block : mBlocks) {
+            block_traits::deallocate(alloc, block, 1);
+        }
+    }
+
+    allocator_type get_allocator() const noexcept {
+        return allocator_type(mAllocator);
+    }
+
+    void swap(EdgePool& rhs) noexcept {
+        Expects(mAllocator == rhs.mAllocator);
+        mBlocks.swap(rhs.mBlocks);
+        mAlive.swap(rhs.mAlive);
+        mFree.swap(rhs.mFree);
+        std::swap(mSize, rhs.mSize);
+    }
+
+    // Iterators
+    iterator begin() noexcept {
+        return iterator(this, nextAlive(0));
+    }
+    iterator end() noexcept {
+        return iterator(this, capacity());
+    }
+    const_iterator begin() const noexcept {
+        return const_iterator(this, nextAlive(0));
+    }
+    const_iterator end() const noexcept {
+        return const_iterator(this, capacity());
+    }
+
+    // Capacity
+    [[nodiscard]] bool empty() const noexcept {
+        return mSize == 0;
+    }
+    size_type size() const noexcept {
+        return mSize;
+    }
+    size_type capacity() const noexcept {
+        return static_cast<size_type>(mBlocks.size()) * BlockSize;
+    }
+    void reserve(size_type sz) {
+        while (capacity() < sz) {
+            addBlock();
+        }
+    }
+
+    // Modifiers, the position is ignored and kept for list compatibility.
+    // Free slots are reused first, so iteration follows slot order, not insertion order.
+    template<class... Args>
+    iterator emplace(const_iterator /*pos*/, Args&&... args) {
+        if (mFree.empty()) {
+            addBlock();
+        }
+        const auto slot = mFree.back();
+        value_traits::construct(mAllocator, data(slot), std::forward<Args>(args)...);
+        mFree.pop_back();
+        mAlive[slot / BlockSize] |= uint64_t(1) << (slot % BlockSize);
+        ++mSize;
+        return iterator(this, slot);
+    }
+    template<class... Args>
+    reference emplace_back(Args&&... args) {
+        return *emplace(end(), std::forward<Args>(args)...);
+    }
+    iterator erase(const_iterator pos) noexcept {
+        const auto slot = pos.mSlot;
+        Expects(alive(slot));
+        value_traits::destroy(mAllocator, data(slot));
+        mAlive[slot / BlockSize] &= ~(uint64_t(1) << (slot % BlockSize));
+        mFree.emplace_back(slot);
+        --mSize;
+        return iterator(this, nextAlive(slot + 1));
+    }
+    void clear() noexcept {
+        for (uint32_t slot = nextAlive(0); slot != capacity(); slot = nextAlive(slot + 1)) {
+            value_traits::destroy(mAllocator, data(slot));
+        }
+        std::fill(mAlive.begin(), mAlive.end(), 0);
+        mFree.clear();
+        for (uint32_t slot = capacity(); slot-- != 0;) {
+            mFree.emplace_back(slot);
+        }
+        mSize = 0;
+    }
+private:
+    // slots of the copy are the slots of rhs, so the stored edges can be rebound by slot
+    template<class Pool>
+    void assign(Pool&& rhs) {
+        clear();
+        reserve(rhs.capacity());
+        for (uint32_t slot = rhs.nextAlive(0); slot != rhs.capacity(); slot = rhs.nextAlive(slot + 1)) {
+            if constexpr (std::is_lvalue_reference_v<Pool>) {
+                value_traits::construct(mAllocator, data(slot), *rhs.data(slot));
+            } else {
+                value_traits::construct(mAllocator, data(slot), std::move(*rhs.data(slot)));
+            }
+            mAlive[slot / BlockSize] |= uint64_t(1) << (slot % BlockSize);
+        }
+        mFree.clear();
+        for (uint32_t slot = capacity(); slot-- != 0;) {
+            if (!alive(slot)) {
+                mFree.emplace_back(slot);
+            }
+        }
+        mSize = rhs.mSize;
+    }
+    void addBlock() {
+        block_allocator alloc(mAllocator);
+        mBlocks.emplace_back(block_traits::allocate(alloc, 1));
+        mAlive.emplace_back(0);
+        // every slot can be freed, so erase and clear never allocate
+        mFree.reserve(capacity());
+        // lowest slot on top, so a new block fills in slot order
+        const auto first = capacity() - BlockSize;
+        mFree.insert(mFree.begin(), BlockSize, 0);
+        for (uint32_t i = 0; i != BlockSize; ++i) {
+            mFree[i] = first + BlockSize - 1 - i;
+        }
+    }
+    bool alive(uint32_t slot) const noexcept {
+        return (mAlive[slot / BlockSize] >> (slot % BlockSize)) & 1;
+    }
+    T* data(uint32_t slot) const noexcept {
+        auto* block = mBlocks[slot / BlockSize];
+        return std::launder(reinterpret_cast<T*>(block->mStorage) + slot % BlockSize);
+    }
+    // first alive slot not before slot, capacity() if none
+    uint32_t nextAlive(uint32_t slot) const noexcept {
+        auto word = slot / BlockSize;
+        if (word >= mAlive.size()) {
+            return capacity();
+        }
+        auto bits = mAlive[word] & (~uint64_t(0) << (slot % BlockSize));
+        while (!bits) {
+            if (++word == mAlive.size()) {
+                return capacity();
+            }
+            bits = mAlive[word];
+        }
+        return word * BlockSize + std::countr_zero(bits);
+    }
+    // last alive slot not after slot, the slot must exist
+    uint32_t prevAlive(uint32_t slot) const noexcept {
+        auto word = slot / BlockSize;
+        auto bits = mAlive[word] & (~uint64_t(0) >> (BlockSize - 1 - slot % BlockSize));
+        while (!bits) {
+            Expects(word != 0);
+            bits = mAlive[--word];
+        }
+        return word * BlockSize + BlockSize - 1 - std::countl_zero(bits);
+    }
+
+    using block_pointer_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<Block*>;
+    using word_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<uint64_t>;
+    using slot_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<uint32_t>;
+
+    std::vector<Block*, block_pointer_allocator> mBlocks;
+    std::vector<uint64_t, word_allocator> mAlive;
+    std::vector<uint32_t, slot_allocator> mFree;
+    uint32_t mSize = 0;
+    value_allocator mAllocator;
+};
+
+// Colors packed in 2 bits per vertex, a 16th of a default_color_type vector.
+// White is zero, so the colors are cleared a word at a time.
+struct PackedColors {
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    PackedColors(size_t numVertices, const allocator_type& alloc)
+        : mWords((numVertices + 31) / 32, 0, alloc)
+    {}
+
+    void clear() noexcept {
+        std::fill(mWords.begin(), mWords.end(), 0);
+    }
+
+    std::pmr::vector<uint64_t> mWords;
+};
+
+// One bit per vertex, for traversals that only mark the vertices reached.
+struct VisitedBitset {
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    VisitedBitset(size_t numVertices, const allocator_type& alloc)
+        : mWords((numVertices + 63) / 64, 0, alloc)
+    {}
+
+    [[nodiscard]] bool test(size_t v) const noexcept {
+        return (mWords[v / 64] >> (v % 64)) & 1;
+    }
+    void set(size_t v) noexcept {
+        mWords[v / 64] |= uint64_t(1) << (v % 64);
+    }
+    void reset(size_t v) noexcept {
+        mWords[v / 64] &= ~(uint64_t(1) << (v % 64));
+    }
+    void clear() noexcept {
+        std::fill(mWords.begin(), mWords.end(), 0);
+    }
+
+    std::pmr::vector<uint64_t> mWords;
+};
+
+// Objects of one polymorphic type paired with their vertices, in storage order.
+// The vertex list holds the vertex of each object, at the index of the object.
+template<class VertexDescriptor, class Object>
+class ObjectVertexIterator : public boost::iterator_facade<
+    ObjectVertexIterator<VertexDescriptor, Object>,
+    std::pair<VertexDescriptor, Object&>,
+    boost::random_access_traversal_tag,
+    std::pair<VertexDescriptor, Object&>> {
+public:
+    ObjectVertexIterator() = default;
+    ObjectVertexIterator(const VertexDescriptor* vertex, Object* object) noexcept
+        : mVertex(vertex), mObject(object) {}
+
+private:
+    friend class boost::iterator_core_access;
+
+    std::pair<VertexDescriptor, Object&> dereference() const noexcept {
+        return { *mVertex, *mObject };
+    }
+    bool equal(const ObjectVertexIterator& rhs) const noexcept {
+        return mObject == rhs.mObject;
+    }
+    void increment() noexcept {
+        ++mVertex;
+        ++mObject;
+    }
+    void decrement() noexcept {
+        --mVertex;
+        --mObject;
+    }
+    void advance(std::ptrdiff_t n) noexcept {
+        mVertex += n;
+        mObject += n;
+    }
+    std::ptrdiff_t distance_to(const ObjectVertexIterator& rhs) const noexcept {
+        return rhs.mObject - mObject;
+    }
+
+    const VertexDescriptor* mVertex = nullptr;
+    Object* mObject = nullptr;
+};
+
+template<class VertexList, class ObjectList>
+inline auto makeObjectRange(const VertexList& vertices, ObjectList& objects) noexcept {
+    using Object = std::remove_pointer_t<decltype(objects.data())>;
+    using Iterator = ObjectVertexIterator<typename VertexList::value_type, Object>;
+    Expects(vertices.size() == objects.size());
+    return boost::make_iterator_range(
+        Iterator(vertices.data(), objects.data()),
+        Iterator(vertices.data() + vertices.size(), objects.data() + objects.size()));
+}
+
 }
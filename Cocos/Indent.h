@@ -26,8 +26,10 @@ THE SOFTWARE.
 
 #pragma once
 #include <memory_resource>
+#include <algorithm>
 #include <string>
-#include <sstream>
+#include <string_view>
+#include <ostream>
 
 namespace Cocos {
 
@@ -67,35 +69,24 @@ inline Indent<std::pmr::string> indent(std::pmr::string& str) {
     return Indent<std::pmr::string>(str);
 }
 
-inline void copyString(std::ostream& os, const std::string& space, std::string_view str, bool append = false) {
-    std::istringstream iss{ std::string(str) };
-    std::string line;
-    int count = 0;
-    while (std::getline(iss, line)) {
-        if (line.empty())
-            os << '\n';
-        else if (line[0] == '#') {
-            os << line << '\n';
-        } else {
-            if (append) {
-                if (count == 0) {
-                    os << line;
-                } else {
-                    os << '\n' << space << line;
-                }
-            } else {
-                os << space << line << '\n';
-            }
+// Splits str into lines the same way std::getline does, without copying.
+// The trailing '\n' is not part of the line, and a final '\n' does not produce an empty line.
+template <class Function>
+inline void forEachLine(std::string_view str, Function&& fn) {
+    size_t pos = 0;
+    while (pos < str.size()) {
+        auto end = str.find('\n', pos);
+        if (end == std::string_view::npos) {
+            end = str.size();
         }
-        ++count;
+        fn(str.substr(pos, end - pos));
+        pos = end + 1;
     }
 }
 
-inline void copyString(std::ostream& os, const std::pmr::string& space, std::string_view str, bool append = false) {
-    std::istringstream iss{ std::string(str) };
-    std::string line;
+inline void copyIndentedString(std::ostream& os, std::string_view space, std::string_view str, bool append) {
     int count = 0;
-    while (std::getline(iss, line)) {
+    forEachLine(str, [&](std::string_view line) {
         if (line.empty())
             os << '\n';
         else if (line[0] == '#') {
@@ -112,7 +103,15 @@ inline void copyString(std::ostream& os, const std::pmr::string& space, std::str
             }
         }
         ++count;
-    }
+    });
+}
+
+inline void copyString(std::ostream& os, const std::string& space, std::string_view str, bool append = false) {
+    copyIndentedString(os, space, str, append);
+}
+
+inline void copyString(std::ostream& os, const std::pmr::string& space, std::string_view str, bool append = false) {
+    copyIndentedString(os, space, str, append);
 }
 
 inline void try_copyString(std::ostream& os, const std::string& space, const std::string& str) {
@@ -121,44 +120,32 @@ inline void try_copyString(std::ostream& os, const std::string& space, const std
     copyString(os, space, str);
 }
 
+inline void copyString(std::ostream& os, std::string_view str) {
+    forEachLine(str, [&](std::string_view line) {
+        os << line << '\n';
+    });
+}
+
 inline void copyString(std::ostream& os, const std::string& str) {
-    std::istringstream iss(str);
-    std::string line;
-    while (std::getline(iss, line)) {
-        if (line.empty())
-            os << '\n';
-        else if (line[0] == '#') {
-            os << line << '\n';
-        } else {
-            os << line << '\n';
-        }
-    }
+    copyString(os, std::string_view(str));
 }
 
 inline void copyString(std::ostream& os, const std::string& str, std::string_view prefix, std::string_view suffix) {
-    std::string str2 = boost::algorithm::replace_all_copy(str, "\r", "");
-    std::istringstream iss(str2);
-    std::string line;
-    while (std::getline(iss, line)) {
+    std::string buffer;
+    forEachLine(str, [&](std::string_view line) {
+        if (line.find('\r') != std::string_view::npos) {
+            buffer.assign(line);
+            buffer.erase(std::remove(buffer.begin(), buffer.end(), '\r'), buffer.end());
+            line = buffer;
+        }
         if (line.empty())
-            continue;
+            return;
         os << prefix << line << suffix;
-    }
+    });
 }
 
 inline void copyString(std::ostream& os, const std::pmr::string& str) {
-    std::basic_istringstream<char, std::char_traits<char>,
-        std::pmr::polymorphic_allocator<char>> iss(str);
-    std::string line;
-    while (std::getline(iss, line)) {
-        if (line.empty())
-            os << '\n';
-        else if (line[0] == '#') {
-            os << line << '\n';
-        } else {
-            os << line << '\n';
-        }
-    }
+    copyString(os, std::string_view(str));
 }
 
 inline void try_copyString(std::ostream& os, const std::string& str, bool addNewLine = true) {
@@ -170,15 +157,13 @@ inline void try_copyString(std::ostream& os, const std::string& str, bool addNew
 }
 
 inline void copyCppString(std::ostream& os, std::string_view space, std::string_view str, bool append = false) {
-    std::istringstream iss{ std::string(str) };
-    std::string line;
     int count = 0;
-    while (std::getline(iss, line)) {
+    forEachLine(str, [&](std::string_view line) {
         if (line.empty()) {
             os << '\n';
         } else if (line[0] == '#') {
             os << line << '\n';
-        } else if (*line.rbegin() == ':') {
+        } else if (line.back() == ':') {
             os << space.substr(0, std::max(size_t(4), space.size()) - 4) << line << "\n";
         } else {
             if (append) {
@@ -192,7 +177,7 @@ inline void copyCppString(std::ostream& os, std::string_view space, std::string_
             }
         }
         ++count;
-    }
+    });
 }
 
 }
@@ -27,6 +27,8 @@ THE SOFTWARE.
 #pragma once
 #include <sstream>
 #include <memory_resource>
+#include <string>
+#include <string_view>
 
 namespace Cocos {
 
@@ -39,4 +41,59 @@ using pmr_ostringstream = std::basic_ostringstream<char, std::char_traits<char>,
 using pmr_istringstream = std::basic_istringstream<char, std::char_traits<char>,
     std::pmr::polymorphic_allocator<char>>;
 
+// Stream buffer appending straight to a pmr string, it keeps no put area.
+class CodeStreamBuf final : public std::streambuf {
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    explicit CodeStreamBuf(const allocator_type& alloc)
+        : mBuffer(alloc) {}
+
+    std::pmr::string mBuffer;
+
+protected:
+    int_type overflow(int_type ch) override {
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            mBuffer.push_back(traits_type::to_char_type(ch));
+        }
+        return traits_type::not_eof(ch);
+    }
+    std::streamsize xsputn(const char* s, std::streamsize count) override {
+        mBuffer.append(s, static_cast<size_t>(count));
+        return count;
+    }
+};
+
+// Code writer used by the builders. Unlike pmr_ostringstream, the written
+// text is never copied out: str() views it and release() moves it out.
+// Indentation is still written by copyString and the OSS macro.
+class CodeStream final : public std::ostream {
+public:
+    using allocator_type = std::pmr::polymorphic_allocator<char>;
+
+    explicit CodeStream(const allocator_type& alloc)
+        : std::ostream(nullptr)
+        , mBuf(alloc) {
+        rdbuf(&mBuf);
+    }
+    CodeStream(const CodeStream&) = delete;
+    CodeStream& operator=(const CodeStream&) = delete;
+
+    void reserve(size_t size) {
+        mBuf.mBuffer.reserve(size);
+    }
+    std::string_view str() const noexcept {
+        return mBuf.mBuffer;
+    }
+    std::pmr::string str(const allocator_type& alloc) const {
+        return std::pmr::string(mBuf.mBuffer, alloc);
+    }
+    std::pmr::string release() noexcept {
+        return std::move(mBuf.mBuffer);
+    }
+
+private:
+    CodeStreamBuf mBuf;
+};
+
 }